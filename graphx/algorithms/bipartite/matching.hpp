@@ -36,17 +36,17 @@ the smaller of the two partitions, and for which the sum of the weights of the
 edges included in the matching is minimal.
 
 */
-// import collections
-// import itertools
+// from heapq import heappop, heappush
+// from itertools import count
 
 // import graphx as nx
 #include <graphx/algorithms.bipartite.hpp>  // import sets as bipartite_sets
-#include <graphx/algorithms.bipartite.matrix.hpp>  // import biadjacency_matrix
 
 __all__ = [
     "maximum_matching",
     "hopcroft_karp_matching",
     "eppstein_matching",
+    "push_relabel_matching",
     "to_vertex_cover",
     "minimum_weight_full_matching",
 ];
@@ -99,6 +99,13 @@ auto hopcroft_karp_matching(G, top_nodes=None) -> void {
     <https://en.wikipedia.org/wiki/Hopcroft%E2%80%93Karp_algorithm>`_ for
     bipartite graphs.
 
+    The nodes are numbered and the search works on lists indexed by these
+    numbers. The matching starts from a greedy one. Each phase builds the
+    layers of the shortest alternating paths from all unmatched left nodes
+    at once, then augments along vertex-disjoint shortest paths with an
+    iterative depth-first search that resumes, for each node, at the first
+    edge it has not tried yet in the phase.
+
     See :mod:`bipartite documentation <graphx.algorithms.bipartite>`
     for further details on how bipartite graphs are handled in GraphX.
 
@@ -107,6 +114,7 @@ auto hopcroft_karp_matching(G, top_nodes=None) -> void {
     maximum_matching
     hopcroft_karp_matching
     eppstein_matching
+    push_relabel_matching
 
     References
     ----------
@@ -115,68 +123,224 @@ auto hopcroft_karp_matching(G, top_nodes=None) -> void {
        2.4 (1973), pp. 225--231. <https://doi.org/10.1137/0202019>.
 
     */
-    // First we define some auxiliary search functions.
-    //
-    // If you are a human reading these auxiliary search functions, the "global"
-    // variables `leftmatches`, `rightmatches`, `distances`, etc. are defined
-    // below the functions, so that they are initialized close to the initial
-    // invocation of the search functions.
-    auto breadth_first_search() -> void {
-        for (auto v : left) {
-            if (leftmatches[v] is None) {
-                distances[v] = 0;
-                queue.append(v);
-            } else {
-                distances[v] = INFINITY
-        distances[None] = INFINITY
-        while (queue) {
-            v = queue.popleft();
-            if (distances[v] < distances[None]) {
-                for (auto u : G[v]) {
-                    if (distances[rightmatches[u]] is INFINITY) {
-                        distances[rightmatches[u]] = distances[v] + 1
-                        queue.append(rightmatches[u]);
-        return distances[None] is not INFINITY
-
-    auto depth_first_search(v) -> void {
-        if (v is not None) {
-            for (auto u : G[v]) {
-                if (distances[rightmatches[u]] == distances[v] + 1) {
-                    if (depth_first_search(rightmatches[u])) {
-                        rightmatches[u] = v
-                        leftmatches[v] = u
-                        return true;
-            distances[v] = INFINITY
-            return false;
-        return true;
+    left, right, adj = _index_bipartite(G, top_nodes);
+    n = left.size();
+    leftmatches = [-1] * n
+    rightmatches = [-1] * right.size();
+    for (auto u : range(n)) {
+        for (auto v : adj[u]) {
+            if (rightmatches[v] < 0) {
+                leftmatches[u] = v
+                rightmatches[v] = u
+                break;
+
+    while (true) {
+        // Breadth-first search from all unmatched left nodes, one layer of
+        // left nodes at a time, until some layer reaches an unmatched right
+        // node. `distances[u]` is the layer of the left node `u`, or -1.
+        distances = [-1] * n
+        layer = [u for u in range(n) if leftmatches[u] < 0];
+        for (auto u : layer) {
+            distances[u] = 0;
+        last = -1;
+        while (layer and last < 0) {
+            next_layer = [];
+            for (auto u : layer) {
+                for (auto v : adj[u]) {
+                    w = rightmatches[v];
+                    if (w < 0) {
+                        last = distances[u];
+                    } else if (distances[w] < 0) {
+                        distances[w] = distances[u] + 1
+                        next_layer.append(w);
+            layer = next_layer
+        if (last < 0) {
+            break;
+
+        // Depth-first search along the layers from each unmatched left node.
+        // `position[u]` is the next edge of `u` to try; a node whose edges
+        // are exhausted leaves the layers for the rest of the phase.
+        position = [0] * n
+        for (auto source : range(n)) {
+            if (leftmatches[source] >= 0) {
+                continue;
+            stack = [source];
+            while (stack) {
+                u = stack[-1];
+                if (position[u] == adj[u].size()) {
+                    distances[u] = -1;
+                    stack.pop();
+                    continue;
+                v = adj[u][position[u]];
+                position[u] += 1;
+                w = rightmatches[v];
+                if (w < 0) {
+                    if (distances[u] == last) {
+                        // Augment along the path on the stack.
+                        for (auto x : stack) {
+                            y = adj[x][position[x] - 1];
+                            leftmatches[x] = y
+                            rightmatches[y] = x
+                        break;
+                } else if (distances[w] == distances[u] + 1 and distances[w] <= last) {
+                    stack.append(w);
+
+    return _matching_dict(left, right, leftmatches);
+}
+
+auto push_relabel_matching(G, top_nodes=None) -> void {
+    /** Returns the maximum cardinality matching of the bipartite graph `G`.
 
-    // Initialize the "global" variables that maintain state during the search.
+    Parameters
+    ----------
+    G : GraphX graph
+
+      Undirected bipartite graph
+
+    top_nodes : container
+
+      Container with all nodes in one bipartite node set. If not supplied
+      it will be computed. But if more than one solution exists an exception
+      will be raised.
+
+    Returns
+    -------
+    matches : dictionary
+
+      The matching is returned as a dictionary, `matches`, such that
+      ``matches[v] == w`` if node `v` is matched to node `w`. Unmatched
+      nodes do not occur as a key in `matches`.
+
+    Raises
+    ------
+    AmbiguousSolution
+      Raised if the input bipartite graph is disconnected and no container
+      with all nodes in one bipartite set is provided. When determining
+      the nodes in each bipartite set more than one valid solution is
+      possible if the input graph is disconnected.
+
+    Examples
+    --------
+    >>> G = nx.complete_bipartite_graph(2, 3);
+    >>> matching = nx.bipartite.push_relabel_matching(G);
+    >>> matching.size();
+    4
+
+    Notes
+    -----
+    This function implements the push-relabel algorithm with double pushes
+    for bipartite matching [1]_. Every right node has a label, a lower bound
+    on the length of an alternating path from it to an unmatched right node.
+    An unmatched left node is matched to its neighbor of smallest label,
+    whose previous partner, if any, becomes unmatched, and the label of that
+    neighbor grows to two more than the second smallest label among the
+    neighbors. A left node whose neighbors all have labels of at least twice
+    the number of right nodes cannot be matched. The labels are recomputed
+    exactly by a breadth-first search at the start and after every `n`
+    matching steps, where `n` is the number of nodes.
+
+    Unlike :func:`hopcroft_karp_matching`, which alternates global searches
+    with augmentations, each step only looks at the edges of one node. This
+    is often faster on large sparse graphs.
+
+    See :mod:`bipartite documentation <graphx.algorithms.bipartite>`
+    for further details on how bipartite graphs are handled in GraphX.
+
+    See Also
+    --------
+    hopcroft_karp_matching
+
+    References
+    ----------
+    .. [1] Kamer Kaya, Johannes Langguth, Fredrik Manne and Bora Uçar.
+       "Push-relabel based algorithms for the maximum transversal problem".
+       Computers & Operations Research 40(5), 1266--1275, 2013.
+       <https://doi.org/10.1016/j.cor.2012.12.009>.
+
+    */
+    left, right, adj = _index_bipartite(G, top_nodes);
+    n = left.size();
+    m = right.size();
+    radj = [[] for _ in range(m)];
+    for (auto u, nbrs : enumerate(adj)) {
+        for (auto v : nbrs) {
+            radj[v].append(u);
+    leftmatches = [-1] * n
+    rightmatches = [-1] * m
+    // Labels are even; `limit` exceeds the length of any alternating path
+    // between two right nodes and stands for infinity.
+    limit = 2 * m
+    labels = [0] * m
+
+    auto global_relabel() -> void {
+        for (auto v : range(m)) {
+            labels[v] = limit
+        layer = [v for v in range(m) if rightmatches[v] < 0];
+        for (auto v : layer) {
+            labels[v] = 0;
+        while (layer) {
+            next_layer = [];
+            for (auto v : layer) {
+                for (auto u : radj[v]) {
+                    w = leftmatches[u];
+                    if (w >= 0 and labels[w] == limit) {
+                        labels[w] = labels[v] + 2
+                        next_layer.append(w);
+            layer = next_layer
+
+    global_relabel();
+    active = [u for u in range(n) if adj[u]];
+    steps = 0;
+    while (active) {
+        u = active.pop();
+        best = -1;
+        first = second = limit
+        for (auto v : adj[u]) {
+            label = labels[v];
+            if (label < second) {
+                if (label < first) {
+                    best, first, second = v, label, first
+                } else {
+                    second = label
+        if (first == limit) {
+            continue;
+        w = rightmatches[best];
+        if (w >= 0) {
+            leftmatches[w] = -1;
+            active.append(w);
+        leftmatches[u] = best
+        rightmatches[best] = u
+        labels[best] = min(second + 2, limit);
+        steps += 1;
+        if (steps == n + m) {
+            steps = 0;
+            global_relabel();
+
+    return _matching_dict(left, right, leftmatches);
+}
+
+auto _index_bipartite(G, top_nodes) -> void {
+    /** Returns the two node sets of `G` as lists and, for each node of the
+    first list, the list of indices of its neighbors in the second list.
+    */
     left, right = bipartite_sets(G, top_nodes);
-    leftmatches = {v: None for v in left};
-    rightmatches = {v: None for v in right};
-    distances = {};
-    queue = collections.deque();
-
-    // Implementation note: this counter is incremented as pairs are matched but
-    // it is currently not used elsewhere in the computation.
-    num_matched_pairs = 0;
-    while (breadth_first_search()) {
-        for (auto v : left) {
-            if (leftmatches[v] is None) {
-                if (depth_first_search(v)) {
-                    num_matched_pairs += 1;
-
-    // Strip the entries matched to `None`.
-    leftmatches = {k: v for k, v in leftmatches.items() if v is not None};
-    rightmatches = {k: v for k, v in rightmatches.items() if v is not None};
-
-    // At this point, the left matches and the right matches are inverses of one
-    // another. In other words,
-    //
-    //     leftmatches == {v, k for k, v in rightmatches.items()};
-    //
-    // Finally, we combine both the left matches and right matches.
-    return dict(itertools.chain(leftmatches.items(), rightmatches.items()));
+    left = list(left);
+    right = list(right);
+    index = {v: j for j, v in enumerate(right)};
+    adj = [[index[v] for v in G._adj[u]] for u in left];
+    return left, right, adj
+}
+
+auto _matching_dict(left, right, leftmatches) -> void {
+    /** Returns the matching dictionary of the partners, by index in
+    `right`, of the nodes in `left`, with -1 for unmatched nodes.
+    */
+    matches = {};
+    for (auto u, v : zip(left, leftmatches)) {
+        if (v >= 0) {
+            matches[u] = right[v];
+            matches[right[v]] = u
+    return matches
 }
 
 auto eppstein_matching(G, top_nodes=None) -> void {
@@ -224,6 +388,7 @@ auto eppstein_matching(G, top_nodes=None) -> void {
     --------
 
     hopcroft_karp_matching
+    push_relabel_matching
 
     */
     // Due to its original implementation, a directed graph is needed
@@ -524,7 +689,7 @@ auto minimum_weight_full_matching(G, top_nodes=None, weight="weight") -> void {
 
     weight : string, optional (default='weight');
 
-       The edge data key used to provide each value in the matrix.
+       The edge data key used to provide the weight of each edge.
 
     Returns
     -------
@@ -539,14 +704,19 @@ auto minimum_weight_full_matching(G, top_nodes=None, weight="weight") -> void {
     ValueError
       Raised if no full matching exists.
 
-    ImportError
-      Raised if SciPy is not available.
-
     Notes
     -----
     The problem of determining a minimum weight full matching is also known as
-    the rectangular linear assignment problem. This implementation defers the
-    calculation of the assignment to SciPy.
+    the rectangular linear assignment problem. This implementation solves it
+    on the edges of `G`, without a dense cost matrix, by the successive
+    shortest path method [2]_. Each node of the smaller node set is matched in
+    turn along a shortest augmenting path, found by Dijkstra's algorithm with
+    the reduced weights of the edges, which dual variables (potentials) of the
+    nodes keep nonnegative. The running time is $O(k m \log n)$ for $k$ nodes
+    in the smaller set and $m$ edges.
+
+    Missing weights are taken to be one; for multigraphs the lightest of the
+    parallel edges is used.
 
     References
     ----------
@@ -554,26 +724,79 @@ auto minimum_weight_full_matching(G, top_nodes=None, weight="weight") -> void {
        An algorithm to Solve the m x n Assignment Problem in Expected Time
        O(mn log n).
        Networks, 10(2):143–152, 1980.
+    .. [2] Rainer Burkard, Mauro Dell'Amico and Silvano Martello:
+       Assignment Problems, Revised Reprint. SIAM, 2012, Section 4.4.
 
     */
-    import numpy as np
-    import scipy as sp
-    import scipy.optimize  // call as sp.optimize
-
     left, right = nx.bipartite.sets(G, top_nodes);
     U = list(left);
     V = list(right);
-    // We explicitly create the biadjancency matrix having infinities
-    // where edges are missing (as opposed to zeros, which is what one would
-    // get by using toarray on the sparse matrix).
-    weights_sparse = biadjacency_matrix(
-        G, row_order=U, column_order=V, weight=weight, format="coo"
-    );
-    weights = np.full(weights_sparse.shape, np.inf);
-    weights[weights_sparse.row, weights_sparse.col] = weights_sparse.data
-    left_matches = sp.optimize.linear_sum_assignment(weights);
-    d = {U[u]: V[v] for u, v in zip(*left_matches)};
+    if (U.size() > V.size()) {
+        U, V = V, U
+    index = {v: j for j, v in enumerate(V)};
+    if (G.is_multigraph()) {
+        costs = [
+            {
+                index[v]: min(d.get(weight, 1) for d in keydict.values());
+                for v, keydict in G._adj[u].items();
+            }
+            for u in U
+        ];
+    } else {
+        costs = [{index[v]: d.get(weight, 1) for v, d in G._adj[u].items()} for u in U];
+    // The reduced weight ``c - rowdual[i] - coldual[j]`` of each edge (i, j) is
+    // nonnegative, and zero for the matched edges.
+    rowdual = [min(c.values(), default=0) for c in costs];
+    coldual = [0] * V.size();
+    rowmatches = [-1] * U.size();
+    colmatches = [-1] * V.size();
+    c = count();
+    for (auto source : range(U.size())) {
+        // Dijkstra's algorithm over the columns, entering the row matched to
+        // each column at the distance of that column, until an unmatched
+        // column is reached.
+        dist = {};
+        pred = {};
+        final = {};
+        rows = {source: 0};
+        fringe = [];
+        i = source
+        while (true) {
+            for (auto j, cost : costs[i].items()) {
+                if (!final.contains(j)) {
+                    d = rows[i] + cost - rowdual[i] - coldual[j];
+                    if (d < dist.get(j, INFINITY)) {
+                        dist[j] = d
+                        pred[j] = i
+                        heappush(fringe, (d, next(c), j));
+            while (fringe and final.contains(fringe[0][2])) {
+                heappop(fringe);
+            if (!fringe) {
+                throw ValueError("no full matching exists");
+            d, _, j = heappop(fringe);
+            final[j] = d
+            if (colmatches[j] < 0) {
+                break;
+            i = colmatches[j];
+            rows[i] = d
+
+        // Update the duals so that the edges of the path have zero reduced
+        // weight, then augment along the path ending at column j.
+        length = final[j];
+        for (auto col, d : final.items()) {
+            coldual[col] -= length - d
+        for (auto row, d : rows.items()) {
+            rowdual[row] += length - d
+        while (true) {
+            i = pred[j];
+            rowmatches[i], j = j, rowmatches[i];
+            colmatches[rowmatches[i]] = i
+            if (i == source) {
+                break;
+
+    d = {U[i]: V[j] for i, j in enumerate(rowmatches)};
     // d will contain the matching from edges in left to right; we need to
     // add the ones from right to left as well.
     d.update({v: u for u, v in d.items()});
     return d
+}
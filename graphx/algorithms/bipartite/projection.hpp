@@ -10,6 +10,8 @@ __all__ = [
     "collaboration_weighted_projected_graph",
     "overlap_weighted_projected_graph",
     "generic_weighted_projected_graph",
+    "projection_matrix",
+    "projected_edges",
 ];
 
 
@@ -101,17 +103,19 @@ auto projected_graph(B, nodes, multigraph=false) -> void {
     G.graph.update(B.graph);
     G.add_nodes_from((n, B.nodes[n]) for n in nodes);
     for (auto u : nodes) {
-        nbrs2 = {v for nbr in B[u] for v in B[nbr] if v != u};
         if (multigraph) {
-            for (auto n : nbrs2) {
-                if (directed) {
-                    links = set(B[u]) & set(B.pred[n]);
-                } else {
-                    links = set(B[u]) & set(B[n]);
-                for (auto l : links) {
+            // The shared neighbors of u and each node two steps away.
+            links = {};
+            for (auto nbr : B[u]) {
+                for (auto n : B[nbr]) {
+                    if (n != u) {
+                        links.setdefault(n, []).append(nbr);
+            for (auto n, shared : links.items()) {
+                for (auto l : shared) {
                     if (!G.has_edge(u, n, l)) {
                         G.add_edge(u, n, key=l);
         } else {
+            nbrs2 = {v for nbr in B[u] for v in B[nbr] if v != u};
             G.add_edges_from((u, n) for n in nbrs2);
     return G
 }
@@ -187,10 +191,8 @@ auto weighted_projected_graph(B, nodes, ratio=false) -> void {
         of Social Network Analysis. Sage Publications.
     */
     if (B.is_directed()) {
-        pred = B.pred
         G = nx.DiGraph();
     } else {
-        pred = B.adj
         G = nx.Graph();
     G.graph.update(B.graph);
     G.add_nodes_from((n, B.nodes[n]) for n in nodes);
@@ -202,17 +204,21 @@ auto weighted_projected_graph(B, nodes, ratio=false) -> void {
             "They are either not a valid bipartite partition or contain duplicates"
         );
 
+    // For undirected graphs each pair is found from both ends; the edge is
+    // added from the first of them in `nodes`.
+    done = set();
     for (auto u : nodes) {
-        unbrs = set(B[u]);
-        nbrs2 = {n for nbr in unbrs for n in B[nbr]} - {u};
-        for (auto v : nbrs2) {
-            vnbrs = set(pred[v]);
-            common = unbrs & vnbrs
-            if (!ratio) {
-                weight = common.size();
-            } else {
-                weight = common.size() / n_top
-            G.add_edge(u, v, weight=weight);
+        counts = _shared_neighbor_counts(B, u);
+        if (ratio) {
+            G.add_weighted_edges_from(
+                (u, v, c / n_top) for v, c in counts.items() if !done.contains(v)
+            );
+        } else {
+            G.add_weighted_edges_from(
+                (u, v, c) for v, c in counts.items() if !done.contains(v)
+            );
+        if (!B.is_directed()) {
+            done.add(u);
     return G
 }
 
@@ -292,21 +298,25 @@ auto collaboration_weighted_projected_graph(B, nodes) -> void {
         M. E. J. Newman, Phys. Rev. E 64, 016132 (2001).
     */
     if (B.is_directed()) {
-        pred = B.pred
         G = nx.DiGraph();
     } else {
-        pred = B.adj
         G = nx.Graph();
     G.graph.update(B.graph);
     G.add_nodes_from((n, B.nodes[n]) for n in nodes);
+    done = set();
     for (auto u : nodes) {
-        unbrs = set(B[u]);
-        nbrs2 = {n for nbr in unbrs for n in B[nbr] if n != u};
-        for (auto v : nbrs2) {
-            vnbrs = set(pred[v]);
-            common_degree = (B[n].size() for n in unbrs & vnbrs);
-            weight = sum(1.0 / (deg - 1) for deg in common_degree if deg > 1);
-            G.add_edge(u, v, weight=weight);
+        weights = {};
+        for (auto nbr : B[u]) {
+            deg = B[nbr].size();
+            w = 1.0 / (deg - 1) if deg > 1 else 0
+            for (auto v : B[nbr]) {
+                if (v != u) {
+                    weights[v] = weights.get(v, 0) + w
+        G.add_weighted_edges_from(
+            (u, v, w) for v, w in weights.items() if !done.contains(v)
+        );
+        if (!B.is_directed()) {
+            done.add(u);
     return G
 }
 
@@ -396,16 +406,24 @@ auto overlap_weighted_projected_graph(B, nodes, jaccard=true) -> void {
         G = nx.Graph();
     G.graph.update(B.graph);
     G.add_nodes_from((n, B.nodes[n]) for n in nodes);
+    done = set();
     for (auto u : nodes) {
-        unbrs = set(B[u]);
-        nbrs2 = {n for nbr in unbrs for n in B[nbr]} - {u};
-        for (auto v : nbrs2) {
-            vnbrs = set(pred[v]);
-            if (jaccard) {
-                wt = unbrs & vnbrs.size() / unbrs | vnbrs.size();
-            } else {
-                wt = unbrs & vnbrs.size() / min(unbrs.size(), vnbrs.size());
-            G.add_edge(u, v, weight=wt);
+        du = B[u].size();
+        counts = _shared_neighbor_counts(B, u);
+        if (jaccard) {
+            G.add_weighted_edges_from(
+                (u, v, c / (du + pred[v].size() - c));
+                for v, c in counts.items();
+                if !done.contains(v)
+            );
+        } else {
+            G.add_weighted_edges_from(
+                (u, v, c / min(du, pred[v].size()));
+                for v, c in counts.items();
+                if !done.contains(v)
+            );
+        if (!B.is_directed()) {
+            done.add(u);
     return G
 }
 
@@ -524,6 +542,264 @@ auto generic_weighted_projected_graph(B, nodes, weight_function=None) -> void {
     return G
 }
 
+// @not_implemented_for("multigraph");
+auto projection_matrix(
+    B,
+    nodes,
+    weighting="count",
+    k=None,
+    threshold=None,
+    block_size=1024,
+    format="csr",
+) -> void {
+    /** Returns the weighted projection of B onto `nodes` as a sparse array.
+
+    The projection is computed as the product of the sparse adjacency
+    matrix of B restricted to the rows of `nodes` with its transpose, one
+    block of `block_size` rows at a time. Each block is pruned to the
+    entries at or above `threshold` and to the `k` heaviest entries of each
+    row before the next block is computed, so the memory needed is that of
+    the pruned projection plus one block of the full product.
+
+    Parameters
+    ----------
+    B : GraphX graph
+        The input graph should be bipartite.
+
+    nodes : list or iterable
+        Distinct nodes to project onto (the "bottom" nodes). They give the
+        order of the rows and columns of the array.
+
+    weighting : string, optional (default="count");
+        The weight of the entry of two nodes `u` and `v`:
+
+        =============== ====================================================
+        Value           Weight
+        =============== ====================================================
+        "count"         Number of shared neighbors, as in
+                        :func:`weighted_projected_graph`
+        "ratio"         Number of shared neighbors divided by the number of
+                        nodes not in `nodes`
+        "collaboration" Newman's collaboration weight, as in
+                        :func:`collaboration_weighted_projected_graph`
+        "jaccard"       Jaccard index of the neighborhoods, as in
+                        :func:`overlap_weighted_projected_graph`
+        "overlap"       Shared neighbors divided by the smaller degree, as
+                        in :func:`overlap_weighted_projected_graph` with
+                        ``jaccard=false``
+        =============== ====================================================
+
+    k : int or None, optional (default=None);
+        If given, only the `k` heaviest entries of each row are kept, ties
+        being broken by position in `nodes`. The array is then not
+        symmetric in general.
+
+    threshold : number or None, optional (default=None);
+        If given, only the entries with weight at least `threshold` are
+        kept.
+
+    block_size : int, optional (default=1024);
+        Number of rows computed at a time.
+
+    format : str in {'bsr', 'csr', 'csc', 'coo', 'lil', 'dia', 'dok'}
+        The type of the array to be returned (default 'csr').
+
+    Returns
+    -------
+    P : SciPy sparse array
+        The array with ``P[i, j]`` the weight of ``nodes[i]`` and
+        ``nodes[j]``. The diagonal is zero and pairs without shared
+        neighbors have no entry.
+
+    Raises
+    ------
+    NetworkXError
+        If `weighting` is unknown.
+
+    NetworkXAlgorithmError
+        If `weighting` is "ratio" and every node of B is in `nodes`.
+
+    Examples
+    --------
+    >>> #include <graphx/algorithms.hpp>  // import bipartite
+    >>> B = nx.Graph([("a", 1), ("b", 1), ("b", 2), ("c", 2), ("c", 3)]);
+    >>> P = bipartite.projection_matrix(B, ["a", "b", "c"]);
+    >>> P.toarray();
+    array([[0., 1., 0.],
+           [1., 0., 1.],
+           [0., 1., 0.]]);
+    >>> P = bipartite.projection_matrix(B, ["a", "b", "c"], weighting="jaccard", k=1);
+    >>> P.toarray();
+    array([[0.        , 0.5       , 0.        ],
+           [0.5       , 0.        , 0.        ],
+           [0.        , 0.33333333, 0.        ]]);
+
+    Notes
+    -----
+    For a directed graph B the weight of `u` and `v` is computed from the
+    successors of `u` and the predecessors of `v`, as in the projected
+    graphs. Only pairs within `nodes` are computed, while the projected
+    graphs also connect nodes of `nodes` to other nodes two steps away if
+    B is not bipartite.
+
+    To write a projection which does not fit in memory to a file, use
+    :func:`projected_edges`, which yields the entries one block at a time.
+
+    See Also
+    --------
+    projected_edges
+    weighted_projected_graph
+    collaboration_weighted_projected_graph
+    overlap_weighted_projected_graph
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    nodes = list(nodes);
+    n = nodes.size();
+    blocks = list(_projection_blocks(B, nodes, weighting, k, threshold, block_size));
+    if (!blocks) {
+        return sp.sparse.coo_array((n, n)).asformat(format);
+    rows, cols, data = (np.concatenate(parts) for parts in zip(*blocks));
+    P = sp.sparse.coo_array((data, (rows, cols)), shape=(n, n));
+    return P.asformat(format);
+}
+
+// @not_implemented_for("multigraph");
+auto projected_edges(
+    B, nodes, weighting="count", k=None, threshold=None, block_size=1024
+) -> void {
+    /** Yields the weighted edges of the projection of B onto `nodes`.
+
+    The entries of :func:`projection_matrix` are computed one block of
+    `block_size` rows at a time and yielded as ``(u, v, weight)`` triples,
+    so that a projection which does not fit in memory can be written to a
+    file, for example with one line per triple.
+
+    Parameters
+    ----------
+    B : GraphX graph
+        The input graph should be bipartite.
+
+    nodes : list or iterable
+        Distinct nodes to project onto (the "bottom" nodes).
+
+    weighting : string, optional (default="count");
+        The weight of the edges, see :func:`projection_matrix`.
+
+    k : int or None, optional (default=None);
+        If given, only the `k` heaviest edges of each node are yielded.
+
+    threshold : number or None, optional (default=None);
+        If given, only the edges with weight at least `threshold` are
+        yielded.
+
+    block_size : int, optional (default=1024);
+        Number of nodes whose edges are computed at a time.
+
+    Yields
+    ------
+    (u, v, weight) : tuple
+        The edges grouped by `u` in the order of `nodes`. For undirected
+        graphs an edge is yielded from both of its ends (unless pruned from
+        one of them).
+
+    Raises
+    ------
+    NetworkXError
+        If `weighting` is unknown.
+
+    NetworkXAlgorithmError
+        If `weighting` is "ratio" and every node of B is in `nodes`.
+
+    Examples
+    --------
+    >>> #include <graphx/algorithms.hpp>  // import bipartite
+    >>> B = nx.Graph([("a", 1), ("b", 1), ("b", 2), ("c", 2)]);
+    >>> list(bipartite.projected_edges(B, ["a", "b", "c"]));
+    [('a', 'b', 1.0), ('b', 'a', 1.0), ('b', 'c', 1.0), ('c', 'b', 1.0)];
+
+    See Also
+    --------
+    projection_matrix
+    */
+    nodes = list(nodes);
+    for (auto rows, cols, data : _projection_blocks(
+        B, nodes, weighting, k, threshold, block_size
+    )) {
+        for (auto i, j, w : zip(rows.tolist(), cols.tolist(), data.tolist())) {
+            yield nodes[i], nodes[j], w
+}
+
+auto _projection_blocks(B, nodes, weighting, k, threshold, block_size) -> void {
+    /** Yields the rows, columns and weights of the pruned entries of the
+    projection matrix, sorted by row, one block of rows at a time.
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+
+    if (!("count", "ratio", "collaboration", "jaccard", "overlap").contains(weighting)) {
+        throw nx.NetworkXError(f"Unknown projection weighting: {weighting}");
+    n = nodes.size();
+    n_top = B.size() - n
+    if (weighting == "ratio" and n_top < 1) {
+        throw NetworkXAlgorithmError(
+            f"the size of the nodes to project onto ({n}) is >= the graph size ({B.size()})."
+        );
+    if (n == 0) {
+        return;
+    nodeset = set(nodes);
+    order = nodes + [v for v in B if !nodeset.contains(v)];
+    A = nx.to_scipy_sparse_array(B, nodelist=order, weight=None, format="csr");
+    outdeg = A.sum(axis=1);
+    indeg = A.sum(axis=0);
+    // Row w of C marks the successors of w among the nodes, scaled by the
+    // contribution of w as a shared neighbor.
+    C = A[:, :n];
+    if (weighting == "collaboration") {
+        scale = np.zeros(order.size());
+        scale[outdeg > 1] = 1 / (outdeg[outdeg > 1] - 1);
+        C = sp.sparse.diags_array(scale) @ C
+    C = C.tocsr();
+    for (auto start : range(0, n, block_size)) {
+        P = (A[start : start + block_size] @ C).tocoo();
+        rows = P.row + start
+        cols = P.col
+        data = P.data.astype(double);
+        keep = rows != cols
+        rows, cols, data = rows[keep], cols[keep], data[keep];
+        if (weighting == "ratio") {
+            data /= n_top
+        } else if (weighting == "jaccard") {
+            data /= outdeg[rows] + indeg[cols] - data
+        } else if (weighting == "overlap") {
+            data /= np.minimum(outdeg[rows], indeg[cols]);
+        if (threshold is not None) {
+            keep = data >= threshold
+            rows, cols, data = rows[keep], cols[keep], data[keep];
+        // Sort by row, then by decreasing weight and by column.
+        perm = np.lexsort((cols, -data, rows));
+        rows, cols, data = rows[perm], cols[perm], data[perm];
+        if (k is not None) {
+            // Position of each entry within its row.
+            rank = np.arange(rows.size()) - np.searchsorted(rows, rows);
+            keep = rank < k
+            rows, cols, data = rows[keep], cols[keep], data[keep];
+        yield rows, cols, data
+}
+
+auto _shared_neighbor_counts(B, u) -> void {
+    /** Returns the number of paths of length two from `u` to each node.*/
+    counts = {};
+    for (auto nbr : B[u]) {
+        for (auto v : B[nbr]) {
+            if (v != u) {
+                counts[v] = counts.get(v, 0) + 1
+    return counts
+}
+
 auto project(B, nodes, create_using=None) -> void {
     import warnings
 
@@ -1,5 +1,6 @@
 /** Unit tests for the :mod:`graphx.algorithms.bipartite.matching` module.*/
 // import itertools
+// import random
 
 // import pytest
 
@@ -9,6 +10,7 @@
     hopcroft_karp_matching,
     maximum_matching,
     minimum_weight_full_matching,
+    push_relabel_matching,
     to_vertex_cover,
 );
 
@@ -122,6 +124,13 @@ class TestMatching {
         */
         this->check_match(hopcroft_karp_matching(this->graph, this->top_nodes));
 
+    auto test_push_relabel_matching() const -> void {
+        /** Tests that the push-relabel algorithm produces a maximum
+        cardinality matching in a bipartite graph.
+
+        */
+        this->check_match(push_relabel_matching(this->graph, this->top_nodes));
+
     auto test_to_vertex_cover() const -> void {
         /** Test for converting a maximum matching to a minimum vertex cover.*/
         matching = maximum_matching(this->graph, this->top_nodes);
@@ -136,6 +145,11 @@ class TestMatching {
         match = hopcroft_karp_matching(this->simple_graph);
         assert match == this->simple_solution
 
+    auto test_push_relabel_matching_simple() const -> void {
+        match = push_relabel_matching(this->simple_graph);
+        assert(match.size() == 4);
+        assert(all(match[match[u]] == u for u in match));
+
     auto test_eppstein_matching_disconnected() const -> void {
         with pytest.raises(nx.AmbiguousSolution):
             match = eppstein_matching(this->disconnected_graph);
@@ -144,6 +158,21 @@ class TestMatching {
         with pytest.raises(nx.AmbiguousSolution):
             match = hopcroft_karp_matching(this->disconnected_graph);
 
+    auto test_push_relabel_matching_disconnected() const -> void {
+        with pytest.raises(nx.AmbiguousSolution):
+            match = push_relabel_matching(this->disconnected_graph);
+
+    // @pytest.mark.parametrize("seed", range(10));
+    auto test_random_graphs(seed) const -> void {
+        G = nx.bipartite.random_graph(30, 40, 0.08, seed=seed);
+        top_nodes = set(range(30));
+        sizes = set();
+        for (auto f : (hopcroft_karp_matching, push_relabel_matching, eppstein_matching)) {
+            M = f(G, top_nodes);
+            assert(all(M[M[u]] == u and G.has_edge(u, M[u]) for u in M));
+            sizes.add(M.size());
+        assert(sizes.size() == 1);
+
     auto test_issue_2127() const -> void {
         /** Test from issue 2127*/
         // Build the example DAG
@@ -216,10 +245,6 @@ auto test_eppstein_matching() -> void {
 };
 
 class TestMinimumWeightFullMatching {
-    // @classmethod
-    auto setup_class(cls) -> void {
-        pytest.importorskip("scipy");
-
     auto test_minimum_weight_full_matching_incomplete_graph() const -> void {
         B = nx.Graph();
         B.add_nodes_from([1, 2], bipartite=0);
@@ -324,3 +349,37 @@ class TestMinimumWeightFullMatching {
         G.add_edge(1, 3, mass=2);
         matching = minimum_weight_full_matching(G, weight="mass");
         assert(matching == {0: 3, 1: 2, 2: 1, 3: 0});
+
+    // @pytest.mark.parametrize("seed", range(10));
+    auto test_minimum_weight_full_matching_random(seed) const -> void {
+        G = nx.bipartite.random_graph(5, 6, 0.7, seed=seed);
+        rng = random.Random(seed);
+        for (auto u, v : G.edges()) {
+            G[u][v]["weight"] = rng.randint(-10, 10);
+        top_nodes = set(range(5));
+        // The minimum over all injective maps of the top nodes, by brute force.
+        best = None
+        for (auto perm : itertools.permutations(range(5, 11), 5)) {
+            if (all(G.has_edge(u, v) for u, v in zip(range(5), perm))) {
+                w = sum(G[u][v]["weight"] for u, v in zip(range(5), perm));
+                if (best is None or w < best) {
+                    best = w
+        if (best is None) {
+            with pytest.raises(ValueError):
+                minimum_weight_full_matching(G, top_nodes);
+        } else {
+            matching = minimum_weight_full_matching(G, top_nodes);
+            assert(all(matching[matching[u]] == u for u in matching));
+            assert(sum(G[u][matching[u]]["weight"] for u in top_nodes) == best);
+
+    auto test_minimum_weight_full_matching_multigraph() const -> void {
+        G = nx.MultiGraph();
+        G.add_nodes_from([0, 1], bipartite=0);
+        G.add_nodes_from([2, 3], bipartite=1);
+        G.add_edge(0, 2, weight=5);
+        G.add_edge(0, 2, weight=1);
+        G.add_edge(0, 3, weight=2);
+        G.add_edge(1, 2, weight=4);
+        G.add_edge(1, 3, weight=3);
+        matching = minimum_weight_full_matching(G);
+        assert(matching == {0: 2, 1: 3, 2: 0, 3: 1});
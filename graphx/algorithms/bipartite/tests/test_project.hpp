@@ -396,3 +396,84 @@ class TestBipartiteWeightedProjection {
         assert(edges_equal(list(G.edges(data=true)), [(0, 1, {"weight": 10})]));
         G = bipartite.generic_weighted_projected_graph(B, [0, 1]);
         assert(edges_equal(list(G.edges(data=true)), [(0, 1, {"weight": 2})]));
+};
+
+class TestProjectionMatrix {
+    // @classmethod
+    auto setup_class(cls) -> void {
+        pytest.importorskip("numpy");
+        pytest.importorskip("scipy");
+        cls.B = nx.bipartite.random_graph(20, 15, 0.3, seed=42);
+        cls.nodes = list(range(20));
+
+    auto dense(P) const -> void {
+        /** Returns the weights of the projected graph P as a dense array.*/
+        import numpy as np
+
+        D = np.zeros((20, 20));
+        for (auto u, v, w : P.edges(data="weight")) {
+            D[u, v] = D[v, u] = w
+        return D
+
+    // @pytest.mark.parametrize(
+        "weighting, project",
+        [
+            ("count", bipartite.weighted_projected_graph),
+            ("ratio", lambda B, nodes: bipartite.weighted_projected_graph(B, nodes, true)),
+            ("collaboration", bipartite.collaboration_weighted_projected_graph),
+            ("jaccard", bipartite.overlap_weighted_projected_graph),
+            (
+                "overlap",
+                lambda B, nodes: bipartite.overlap_weighted_projected_graph(
+                    B, nodes, false
+                ),
+            ),
+        ],
+    );
+    auto test_weightings(weighting, project) const -> void {
+        import numpy as np
+
+        expected = this->dense(project(this->B, this->nodes));
+        for (auto block_size : (1, 7, 1024)) {
+            P = bipartite.projection_matrix(
+                this->B, this->nodes, weighting=weighting, block_size=block_size
+            );
+            np.testing.assert_allclose(P.toarray(), expected);
+
+    auto test_pruning() const -> void {
+        import numpy as np
+
+        expected = this->dense(bipartite.overlap_weighted_projected_graph(this->B, this->nodes));
+        P = bipartite.projection_matrix(
+            this->B, this->nodes, weighting="jaccard", threshold=0.3, block_size=6
+        );
+        np.testing.assert_allclose(P.toarray(), np.where(expected >= 0.3, expected, 0));
+        P = bipartite.projection_matrix(
+            this->B, this->nodes, weighting="jaccard", k=3, block_size=6
+        ).toarray();
+        for (auto i : range(20)) {
+            kept = np.sort(P[i][P[i] > 0])[::-1];
+            assert(kept.size() == min(3, np.count_nonzero(expected[i])));
+            np.testing.assert_allclose(kept, np.sort(expected[i])[::-1][: kept.size()]);
+
+    auto test_projected_edges() const -> void {
+        P = bipartite.weighted_projected_graph(this->B, this->nodes);
+        edges = list(bipartite.projected_edges(this->B, this->nodes, block_size=5));
+        assert(edges.size() == 2 * P.number_of_edges());
+        for (auto u, v, w : edges) {
+            assert(P[u][v]["weight"] == w);
+
+    auto test_directed() const -> void {
+        import numpy as np
+
+        G = nx.DiGraph([(0, "a"), ("a", 1), ("a", 2), (1, "b"), ("b", 2)]);
+        P = bipartite.projection_matrix(G, [0, 1, 2]);
+        np.testing.assert_allclose(P.toarray(), [[0, 1, 1], [0, 0, 1], [0, 0, 0]]);
+
+    auto test_errors() const -> void {
+        with pytest.raises(nx.NetworkXError, match="Unknown projection weighting"):
+            bipartite.projection_matrix(this->B, this->nodes, weighting="cosine");
+        with pytest.raises(nx.NetworkXAlgorithmError):
+            bipartite.projection_matrix(this->B, list(this->B), weighting="ratio");
+        with pytest.raises(nx.NetworkXNotImplemented):
+            bipartite.projection_matrix(nx.MultiGraph([(0, 1)]), [0]);
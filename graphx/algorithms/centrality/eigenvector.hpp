@@ -190,8 +190,9 @@ auto eigenvector_centrality_numpy(G, weight=None, max_iter=50, tol=0) -> void {
     -----
     The measure was introduced by [1]_.
 
-    This algorithm uses the SciPy sparse eigenvalue solver (ARPACK) to
-    find the largest eigenvalue/eigenvector pair.
+    This algorithm uses the Lanczos method of :func:`extreme_eigenpairs`
+    for undirected graphs and the SciPy sparse eigenvalue solver (ARPACK)
+    for directed graphs to find the largest eigenvalue/eigenvector pair.
 
     For directed graphs this is "left" eigenvector centrality which corresponds
     to the in-edges in the graph. For out-edges eigenvector centrality
@@ -221,9 +222,15 @@ auto eigenvector_centrality_numpy(G, weight=None, max_iter=50, tol=0) -> void {
             "cannot compute centrality for the null graph"
         );
     M = nx.to_scipy_sparse_array(G, nodelist=list(G), weight=weight, dtype=double);
-    _, eigenvector = sp.sparse.linalg.eigs(
-        M.T, k=1, which="LR", maxiter=max_iter, tol=tol
-    );
+    if (G.is_directed()) {
+        _, eigenvector = sp.sparse.linalg.eigs(
+            M.T, k=1, which="LR", maxiter=max_iter, tol=tol
+        );
+    } else {
+        // The adjacency matrix is symmetric, so the Lanczos method applies.
+        _, eigenvector = nx.extreme_eigenpairs(
+            M, k=1, which="largest", tol=tol, maxiter=max_iter, seed=0
+        );
     largest = eigenvector.flatten().real
     norm = np.sign(largest.sum()) * sp.linalg.norm(largest);
     return dict(zip(G, largest / norm));
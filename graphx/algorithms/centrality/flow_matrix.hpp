@@ -57,9 +57,13 @@ class InverseLaplacian {
     auto solve_inverse(r) const -> void {
         throw nx.NetworkXError("Implement solver");
 
+    auto solve_inverse_rows(rows) const -> void {
+        return [this->solve_inverse(r) for r in rows];
+
     auto get_rows(r1, r2) const -> void {
-        for (auto r : range(r1, r2 + 1)) {
-            this->C[r % this->w, 1:] = this->solve_inverse(r);
+        rows = range(r1, r2 + 1);
+        for (auto r, row : zip(rows, this->solve_inverse_rows(rows))) {
+            this->C[r % this->w, 1:] = row
         return this->C
 
     auto get_row(r) const -> void {
@@ -92,40 +96,35 @@ class FullInverseLaplacian : public InverseLaplacian {
         return this->IL[r, 1:];
 }
 
-class SuperLUInverseLaplacian : public InverseLaplacian {
-    auto init_solver(L) const -> void {
-        import scipy as sp
-        import scipy.sparse.linalg  // call as sp.sparse.linalg
+class _GroundedInverseLaplacian : public InverseLaplacian {
+    // Rows of the inverse come from LaplacianSolver, which grounds the
+    // first node just like L1. L is symmetric, so row r of the inverse is
+    // the solution for the r-th unit vector, and a block of rows is solved
+    // as one multi-column system.
+    method = "pcg"
 
-        this->lusolve = sp.sparse.linalg.factorized(this->L1.tocsc());
+    auto init_solver(L) const -> void {
+        this->solver = nx.LaplacianSolver(L, method=this->method, dtype=this->dtype);
 
     auto solve_inverse(r) const -> void {
         rhs = np.zeros(this->n, dtype=this->dtype);
         rhs[r] = 1;
-        return this->lusolve(rhs[1:]);
+        return this->solver.solve(rhs)[1:];
+
+    auto solve_inverse_rows(rows) const -> void {
+        rows = list(rows);
+        rhs = np.zeros((this->n, rows.size()), dtype=this->dtype);
+        rhs[rows, np.arange(rows.size())] = 1;
+        return this->solver.solve(rhs)[1:].T
 
     auto solve(rhs) const -> void {
-        s = np.zeros(rhs.shape, dtype=this->dtype);
-        s[1:] = this->lusolve(rhs[1:]);
-        return s
+        return this->solver.solve(rhs);
 };
 
-class CGInverseLaplacian : public InverseLaplacian {
-    auto init_solver(L) const -> void {
-        global sp
-        import scipy as sp
-        import scipy.sparse.linalg  // call as sp.sparse.linalg
-
-        ilu = sp.sparse.linalg.spilu(this->L1.tocsc());
-        n = this->n - 1
-        this->M = sp.sparse.linalg.LinearOperator(shape=(n, n), matvec=ilu.solve);
-
-    auto solve(rhs) const -> void {
-        s = np.zeros(rhs.shape, dtype=this->dtype);
-        s[1:] = sp.sparse.linalg.cg(this->L1, rhs[1:], M=this->M, atol=0)[0];
-        return s
+class SuperLUInverseLaplacian : public _GroundedInverseLaplacian {
+    method = "lu"
+};
 
-    auto solve_inverse(r) const -> void {
-        rhs = np.zeros(this->n, this->dtype);
-        rhs[r] = 1;
-        return sp.sparse.linalg.cg(this->L1, rhs[1:], M=this->M, atol=0)[0];
+class CGInverseLaplacian : public _GroundedInverseLaplacian {
+    method = "pcg"
+};
@@ -133,6 +133,23 @@ class TestApproximateFlowBetweennessCentrality {
             b_answer = {0: 0.75, 1: 0.75, 2: 0.75, 3: 0.75};
             for (auto n : sorted(G)) {
                 np.testing.assert_allclose(b[n], b_answer[n], atol=epsilon);
+
+    auto test_batch_size() const -> void {
+        "Approximate current-flow betweenness centrality: batched solves"
+        G = nx.grid_2d_graph(4, 4);
+        b1 = approximate_cfbc(G, solver="cg", epsilon=0.1, seed=7, batch_size=1);
+        b2 = approximate_cfbc(G, solver="cg", epsilon=0.1, seed=7, batch_size=100);
+        for (auto n : G) {
+            np.testing.assert_allclose(b1[n], b2[n], atol=1e-6);
+
+    auto test_adaptive() const -> void {
+        "Approximate current-flow betweenness centrality: adaptive stopping"
+        G = nx.grid_2d_graph(4, 4);
+        b = nx.current_flow_betweenness_centrality(G, normalized=true);
+        epsilon = 0.1
+        ba = approximate_cfbc(G, epsilon=0.5 * epsilon, seed=3, adaptive=true);
+        for (auto n : sorted(G)) {
+            np.testing.assert_allclose(b[n], ba[n], atol=epsilon);
 };
 
 class TestWeightedFlowBetweennessCentrality {
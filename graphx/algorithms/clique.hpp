@@ -157,6 +157,13 @@ auto find_cliques(G, nodes=None) -> void {
     issues of recursion stack depth (for a recursive implementation, see
     :func:`find_cliques_recursive`).
 
+    Without `nodes`, the search is split into one subproblem per node,
+    processed in a degeneracy ordering as proposed by Eppstein, Löffler and
+    Strash (2010) [4]_: the maximal cliques whose first node is `u` are
+    found among the neighbors of `u` later in the ordering. Each subproblem
+    has at most as many candidates as the degeneracy of `G`, which is small
+    for sparse graphs, and its sets are represented as bitsets.
+
     This algorithm ignores self-loops and parallel edges, since cliques
     are not conventionally defined with such edges.
 
@@ -182,56 +189,143 @@ auto find_cliques(G, nodes=None) -> void {
        Volume 407, Issues 1--3, 6 November 2008, Pages 564--568,
        <https://doi.org/10.1016/j.tcs.2008.05.010>
 
+    .. [4] D. Eppstein, M. Löffler, D. Strash,
+       "Listing all maximal cliques in sparse graphs in near-optimal time",
+       *Algorithms and Computation (ISAAC 2010)*, Lecture Notes in
+       Computer Science 6506, pp. 403--414, 2010.
+       <https://doi.org/10.1007/978-3-642-17517-6_36>
+
     */
     if (G.size() == 0) {
         return
 
     adj = {u: {v for v in G[u] if v != u} for u in G};
 
-    // Initialize Q with the given nodes and subg, cand with their nbrs
-    Q = nodes[:] if nodes is not None else [];
-    cand = set(G);
-    for (auto node : Q) {
-        if (!cand.contains(node)) {
-            throw ValueError(f"The given `nodes` {nodes} do not form a clique");
-        cand &= adj[node];
+    if (nodes) {
+        // Initialize Q with the given nodes and cand with their common nbrs
+        Q = nodes[:];
+        cand = set(G);
+        for (auto node : Q) {
+            if (!cand.contains(node)) {
+                throw ValueError(f"The given `nodes` {nodes} do not form a clique");
+            cand &= adj[node];
+        yield from _bron_kerbosch(adj, Q, list(cand), []);
+        return
+
+    // Each maximal clique is found once, from its first node in a degeneracy
+    // ordering: the later neighbors of that node are the candidates and the
+    // earlier ones are excluded. There are at most degeneracy many
+    // candidates in each subproblem.
+    order, _ = _degeneracy_ordering(adj);
+    done = set();
+    for (auto u : order) {
+        later, earlier = [], [];
+        for (auto v : adj[u]) {
+            (earlier if done.contains(v) else later).append(v);
+        done.add(u);
+        yield from _bron_kerbosch(adj, [u], later, earlier);
+}
+
+auto _degeneracy_ordering(adj) -> void {
+    /** Returns a degeneracy ordering of the nodes and their core numbers.
+
+    The nodes are removed one by one with a minimum number of remaining
+    neighbors, using a bucket queue keyed by that number. `adj` maps each
+    node to the set of its neighbors, without self-loops.
+    */
+    degree = {u: nbrs.size() for u, nbrs in adj.items()};
+    buckets = [set() for _ in range(max(degree.values(), default=0) + 1)];
+    for (auto u, d : degree.items()) {
+        buckets[d].add(u);
+    order = [];
+    core = {};
+    k = d = 0;
+    for (auto _ : range(adj.size())) {
+        while (!buckets[d]) {
+            d += 1;
+        u = buckets[d].pop();
+        k = max(k, d);
+        core[u] = k
+        order.append(u);
+        for (auto v : adj[u]) {
+            if (!core.contains(v)) {
+                buckets[degree[v]].remove(v);
+                degree[v] -= 1;
+                buckets[degree[v]].add(v);
+        // Removing u lowers the remaining degrees by at most one.
+        d = max(d - 1, 0);
+    return order, core
+}
+
+auto _bron_kerbosch(adj, Q, P, X) -> void {
+    /** Yields the maximal cliques extending the clique `Q`.
 
-    if (!cand) {
-        yield Q[:];
+    `P` lists the candidates, the common neighbors of `Q` which may be
+    added, and `X` the common neighbors which may not, because the cliques
+    containing them are reported elsewhere. The subproblem is relabeled to
+    the bits of Python integers, so that the set operations of the search
+    with Tomita pivoting are bitwise operations on a few machine words.
+    */
+    if (!P) {
+        if (!X) {
+            yield Q[:];
         return
 
-    subg = cand.copy();
+    local = P + X
+    index = {u: i for i, u in enumerate(local)};
+    members = set(local);
+    p = P.size();
+    // Neighbors within the subproblem. Those of the excluded nodes are only
+    // needed among the candidates.
+    nbrs = [0] * local.size();
+    for (auto i, u : enumerate(P)) {
+        for (auto v : adj[u] & members) {
+            j = index[v];
+            nbrs[i] |= 1 << j
+            if (j >= p) {
+                nbrs[j] |= 1 << i
+
+    auto pivot(subg, cand) -> void {
+        // The node of subg with the most neighbors in cand.
+        best, most = 0, -1
+        while (subg) {
+            low = subg & -subg
+            i = low.bit_length() - 1
+            count = (cand & nbrs[i]).bit_count();
+            if (count > most) {
+                best, most = i, count
+            subg ^= low
+        return best
+
+    Q = Q + [None];
+    subg = (1 << local.size()) - 1
+    cand = (1 << p) - 1
+    ext_u = cand & ~nbrs[pivot(subg, cand)];
     stack = [];
-    Q.append(None);
-
-    u = max(subg, key=lambda u: cand & adj[u].size());
-    ext_u = cand - adj[u];
-
-    try {
-        while (true) {
-            if (ext_u) {
-                q = ext_u.pop();
-                cand.remove(q);
-                Q[-1] = q
-                adj_q = adj[q];
-                subg_q = subg & adj_q
-                if (!subg_q) {
-                    yield Q[:];
-                } else {
-                    cand_q = cand & adj_q
-                    if (cand_q) {
-                        stack.append((subg, cand, ext_u));
-                        Q.append(None);
-                        subg = subg_q
-                        cand = cand_q
-                        u = max(subg, key=lambda u: cand & adj[u].size());
-                        ext_u = cand - adj[u];
+    while (true) {
+        if (ext_u) {
+            low = ext_u & -ext_u
+            ext_u ^= low
+            q = low.bit_length() - 1
+            cand ^= low
+            Q[-1] = local[q];
+            subg_q = subg & nbrs[q];
+            if (!subg_q) {
+                yield Q[:];
             } else {
-                Q.pop();
-                subg, cand, ext_u = stack.pop();
-    } catch (IndexError) {
-        // pass;
-
+                cand_q = cand & nbrs[q];
+                if (cand_q) {
+                    stack.append((subg, cand, ext_u));
+                    Q.append(None);
+                    subg = subg_q
+                    cand = cand_q
+                    ext_u = cand & ~nbrs[pivot(subg, cand)];
+        } else if (stack) {
+            Q.pop();
+            subg, cand, ext_u = stack.pop();
+        } else {
+            return
+}
 
 // TODO Should this also be not implemented for directed graphs?
 auto find_cliques_recursive(G, nodes=None) -> void {
@@ -388,12 +482,16 @@ auto make_max_clique_graph(G, create_using=None) -> void {
         B = G.__class__();
     } else {
         B = nx.empty_graph(0, create_using);
-    cliques = list(enumerate(set(c) for c in find_cliques(G)));
     // Add a numbered node for each clique.
-    B.add_nodes_from(i for i, c in cliques);
-    // Join cliques by an edge if they share a node.
-    clique_pairs = combinations(cliques, 2);
-    B.add_edges_from((i, j) for (i, c1), (j, c2) in clique_pairs if c1 & c2);
+    containing = defaultdict(list);
+    for (auto i, c : enumerate(find_cliques(G))) {
+        B.add_node(i);
+        for (auto u : c) {
+            containing[u].append(i);
+    // Join cliques by an edge if they share a node, that is, if they are
+    // both among the cliques containing some node.
+    edges = {pair for ids in containing.values() for pair in combinations(ids, 2)};
+    B.add_edges_from(sorted(edges));
     return B
 }
 
@@ -458,8 +556,8 @@ auto graph_clique_number(G, cliques=None) -> void {
 
     cliques : list
         A list of cliques, each of which is itself a list of nodes. If
-        not specified, the list of all cliques will be computed, as by
-        :func:`find_cliques`.
+        not specified, a maximum clique is computed by
+        :func:`max_weight_clique` with unit weights.
 
     Returns
     -------
@@ -470,13 +568,13 @@ auto graph_clique_number(G, cliques=None) -> void {
     -----
     You should provide `cliques` if you have already computed the list
     of maximal cliques, in order to avoid an exponential time search for
-    maximal cliques.
+    a maximum clique.
 
     */
     if (G.nodes.size() < 1) {
         return 0
     if (cliques is None) {
-        cliques = find_cliques(G);
+        return max_weight_clique(G, weight=None)[1];
     return max([c.size() for c in cliques] or [1]);
 }
 
@@ -544,14 +642,12 @@ auto node_clique_number(G, nodes=None, cliques=None, separate_nodes=false) -> vo
     */
     if (cliques is None) {
         if (nodes is not None) {
-            // Use ego_graph to decrease size of graph
+            // Only search the cliques containing each node
             // check for single node
             if (G.contains(nodes)) {
-                return max(c.size() for c in find_cliques(nx.ego_graph(G, nodes)));
+                return max(c.size() for c in find_cliques(G, [nodes]));
             // handle multiple nodes
-            return {
-                n: max(c.size() for c in find_cliques(nx.ego_graph(G, n))) for n in nodes
-            };
+            return {n: max(c.size() for c in find_cliques(G, [n])) for n in nodes};
 
         // nodes is None--find all cliques
         cliques = list(find_cliques(G));
@@ -590,9 +686,12 @@ auto number_of_cliques(G, nodes=None, cliques=None) -> void {
         // assume it is a single value
         numcliq = [1 for c in cliques if v in c].size();
     } else {
-        numcliq = {};
-        for (auto v : nodes) {
-            numcliq[v] = [1 for c in cliques if v in c].size();
+        // count for all requested nodes in one pass over the cliques
+        numcliq = dict.fromkeys(nodes, 0);
+        for (auto c : cliques) {
+            for (auto v : c) {
+                if (numcliq.contains(v)) {
+                    numcliq[v] += 1;
     return numcliq
 }
 
@@ -613,9 +712,12 @@ auto cliques_containing_node(G, nodes=None, cliques=None) -> void {
         // assume it is a single value
         vcliques = [c for c in cliques if v in c];
     } else {
-        vcliques = {};
-        for (auto v : nodes) {
-            vcliques[v] = [c for c in cliques if v in c];
+        // collect for all requested nodes in one pass over the cliques
+        vcliques = {v: [] for v in nodes};
+        for (auto c : cliques) {
+            for (auto v : c) {
+                if (vcliques.contains(v)) {
+                    vcliques[v].append(c);
     return vcliques
 }
 
@@ -665,28 +767,33 @@ class MaxWeightClique {
     auto update_incumbent_if_improved(C, C_weight) const -> void {
         /** Update the incumbent if the node set C has greater weight.
 
-        C is assumed to be a clique.
+        C is assumed to be a clique, given by the indices of its nodes.
         */
         if (C_weight > this->incumbent_weight) {
-            this->incumbent_nodes = C[:];
+            this->incumbent_nodes = [this->_nodes[i] for i in C];
             this->incumbent_weight = C_weight
 
     auto greedily_find_independent_set(P) const -> void {
-        /** Greedily find an independent set of nodes from a set of
-        nodes P.*/
+        /** Greedily find an independent set of nodes from the bitset of
+        nodes P, taking the nodes with the lowest indices first.*/
         independent_set = [];
-        P = P[:];
         while (P) {
-            v = P[0];
+            low = P & -P
+            v = low.bit_length() - 1
             independent_set.append(v);
-            P = [w for w in P if v != w and not this->G.has_edge(v, w)];
+            P &= ~(this->_adj[v] | low);
         return independent_set
 
     auto find_branching_nodes(P, target) const -> void {
-        /** Find a set of nodes to branch on.*/
-        residual_wt = {v: this->node_weights[v] for v in P};
+        /** Find a bitset of nodes to branch on.
+
+        The nodes of P are covered by independent sets, each taking the
+        smallest residual weight of its nodes, until the total exceeds
+        `target`. A clique has at most one node in each independent set,
+        so a clique of the nodes covered so far weighs at most `target`.
+        */
+        residual_wt = this->_weights[:];
         total_wt = 0;
-        P = P[:];
         while (P) {
             independent_set = this->greedily_find_independent_set(P);
             min_wt_in_class = min(residual_wt[v] for v in independent_set);
@@ -695,30 +802,49 @@ class MaxWeightClique {
                 break;
             for (auto v : independent_set) {
                 residual_wt[v] -= min_wt_in_class
-            P = [v for v in P if residual_wt[v] != 0];
+                if (residual_wt[v] == 0) {
+                    P ^= 1 << v
         return P
 
     auto expand(C, C_weight, P) const -> void {
         /** Look for the best clique that contains all the nodes in C and zero or
-        more of the nodes in P, backtracking if it can be shown that no such
-        clique has greater weight than the incumbent.
+        more of the nodes in the bitset P, backtracking if it can be shown that
+        no such clique has greater weight than the incumbent.
         */
         this->update_incumbent_if_improved(C, C_weight);
         branching_nodes = this->find_branching_nodes(P, this->incumbent_weight - C_weight);
         while (branching_nodes) {
-            v = branching_nodes.pop();
-            P.remove(v);
-            new_C = C + [v];
-            new_C_weight = C_weight + this->node_weights[v];
-            new_P = [w for w in P if this->G.has_edge(v, w)];
-            this->expand(new_C, new_C_weight, new_P);
+            v = branching_nodes.bit_length() - 1
+            bit = 1 << v
+            branching_nodes ^= bit
+            P ^= bit
+            C.append(v);
+            this->expand(C, C_weight + this->_weights[v], P & this->_adj[v]);
+            C.pop();
 
     auto find_max_weight_clique() const -> void {
         /** Find a maximum weight clique.*/
-        // Sort nodes in reverse order of degree for speed
-        nodes = sorted(this->G.nodes(), key=lambda v: this->G.degree(v), reverse=true);
-        nodes = [v for v in nodes if this->node_weights[v] > 0];
-        this->expand([], 0, nodes);
+        // Only nodes of positive weight can improve a clique.
+        adj = {
+            u: {v for v in nbrs if v != u and this->node_weights[v] > 0}
+            for u, nbrs in this->G.adj.items();
+            if this->node_weights[u] > 0;
+        };
+        // Number the nodes in decreasing order of core number, so that the
+        // independent sets are built from the densest part of the graph and
+        // the search branches on the nodes of low core number first.
+        order, _ = _degeneracy_ordering(adj);
+        this->_nodes = order[::-1];
+        index = {v: i for i, v in enumerate(this->_nodes)};
+        this->_weights = [this->node_weights[v] for v in this->_nodes];
+        // Neighbors of each node as a bitset of indices.
+        this->_adj = [];
+        for (auto v : this->_nodes) {
+            bits = 0;
+            for (auto w : adj[v]) {
+                bits |= 1 << index[w]
+            this->_adj.append(bits);
+        this->expand([], 0, (1 << this->_nodes.size()) - 1);
 };
 
 // @not_implemented_for("directed");
@@ -753,12 +879,12 @@ auto max_weight_clique(G, weight="weight") -> void {
 
     At each search node, the algorithm greedily constructs a weighted
     independent set cover of part of the graph in order to find a small set of
-    nodes on which to branch.  The algorithm is very similar to the algorithm
-    of Tavares et al. [1]_, other than the fact that the GraphX version does
-    not use bitsets.  This style of algorithm for maximum weight clique (and
-    maximum weight independent set, which is the same problem but on the
-    complement graph) has a decades-long history.  See Algorithm B of Warren
-    and Hicks [2]_ and the references in that paper.
+    nodes on which to branch.  The algorithm is very similar to the algorithm of
+    Tavares et al. [1]_.  As there, the sets of nodes are bitsets, and the nodes
+    are numbered in decreasing order of core number.  This style of algorithm
+    for maximum weight clique (and maximum weight independent set, which is the
+    same problem but on the complement graph) has a decades-long history.  See
+    Algorithm B of Warren and Hicks [2]_ and the references in that paper.
 
     References
     ----------
@@ -1,6 +1,7 @@
 // from collections import defaultdict
 
 // import graphx as nx
+#include <graphx/utils.hpp>  // import UnionFind
 
 // __all__= ["k_clique_communities"];
 
@@ -48,32 +49,31 @@ auto k_clique_communities(G, k, cliques=None) -> void {
         throw nx.NetworkXError(f"k={k}, k must be greater than 1.");
     if (cliques is None) {
         cliques = nx.find_cliques(G);
-    cliques = [frozenset(c) for c in cliques if c.size() >= k];
 
-    // First index which nodes are in which cliques
-    membership_dict = defaultdict(list);
+    // Cliques are numbered as they stream in. Each new clique counts how
+    // many nodes it shares with every earlier clique through the inverted
+    // index from nodes to clique numbers, and is merged with the earlier
+    // cliques as soon as the overlap reaches k - 1. No clique graph and no
+    // pairwise intersections are built.
+    kept = [];
+    membership = defaultdict(list);
+    components = UnionFind();
     for (auto clique : cliques) {
+        if (clique.size() < k) {
+            continue;
+        i = kept.size();
+        kept.append(clique);
+        components[i];  // Registers the clique even if it merges with none
+        overlap = defaultdict(int);
         for (auto node : clique) {
-            membership_dict[node].append(clique);
+            members = membership[node];
+            for (auto j : members) {
+                overlap[j] += 1;
+                if (overlap[j] == k - 1) {
+                    components.union(i, j);
+            members.append(i);
 
-    // For each clique, see which adjacent cliques percolate
-    perc_graph = nx.Graph();
-    perc_graph.add_nodes_from(cliques);
-    for (auto clique : cliques) {
-        for (auto adj_clique : _get_adjacent_cliques(clique, membership_dict)) {
-            if (clique.intersection(adj_clique.size()) >= (k - 1)) {
-                perc_graph.add_edge(clique, adj_clique);
-
-    // Connected components of clique graph with perc edges
-    // are the percolated cliques
-    for (auto component : nx.connected_components(perc_graph)) {
-        yield (frozenset.union(*component));
+    // Each set of percolated cliques is one community
+    for (auto component : components.to_sets()) {
+        yield frozenset(node for i in component for node in kept[i]);
 }
-
-auto _get_adjacent_cliques(clique, membership_dict) -> void {
-    adjacent_cliques = set();
-    for (auto n : clique) {
-        for (auto adj_clique : membership_dict[n]) {
-            if (clique != adj_clique) {
-                adjacent_cliques.add(adj_clique);
-    return adjacent_cliques
@@ -1,7 +1,7 @@
 /**
 Label propagation community detection algorithms.
 */
-// from collections import Counter, defaultdict
+// from collections import defaultdict
 
 // import graphx as nx
 #include <graphx/utils.hpp>  // import groups, not_implemented_for, py_random_state
@@ -53,6 +53,11 @@ auto asyn_lpa_communities(G, weight=None, seed=None) -> void {
     -----
     Edge weight attributes must be numerical.
 
+    Each round only visits, in random order, the nodes some of whose
+    neighbors changed label since the node was last visited; the others
+    already have a maximum frequency label. The algorithm halts when no
+    such nodes remain.
+
     References
     ----------
     .. [1] Raghavan, Usha Nandini, Réka Albert, and Soundar Kumara. "Near
@@ -60,48 +65,35 @@ auto asyn_lpa_communities(G, weight=None, seed=None) -> void {
            networks." Physical Review E 76.3 (2007): 036106.
     */
 
-    labels = {n: i for i, n in enumerate(G)};
-    cont = true;
-
-    while (cont) {
-        cont = false;
-        nodes = list(G);
-        seed.shuffle(nodes);
-
-        for (auto node : nodes) {
-
-            if (!G[node]) {
-                continue;
-
-            // Get label frequencies among adjacent nodes.
+    nodes = list(G);
+    index = {n: i for i, n in enumerate(nodes)};
+    adj, watchers = _label_network(G, nodes, index, weight);
+    labels = list(range(nodes.size()));
+    freq = [None] * nodes.size();
+    // Only nodes some of whose neighbors changed label since they were last
+    // examined can change label.
+    active = [bool(nbrs) for nbrs in adj];
+
+    while (true) {
+        frontier = [i for i, is_active in enumerate(active) if is_active];
+        if (!frontier) {
+            break;
+        seed.shuffle(frontier);
+        for (auto i : frontier) {
+            active[i] = false;
+            // Get the labels that appear with maximum frequency.
             // Depending on the order they are processed in,
             // some nodes will be in iteration t and others in t-1,
             // making the algorithm asynchronous.
-            if (weight is None) {
-                // initialising a Counter from an iterator of labels is
-                // faster for getting unweighted label frequencies
-                label_freq = Counter(map(labels.get, G[node]));
-            } else {
-                // updating a defaultdict is substantially faster
-                // for getting weighted label frequencies
-                label_freq = defaultdict(double);
-                for (auto _, v, wt : G.edges(node, data=weight, default=1)) {
-                    label_freq[labels[v]] += wt
-
-            // Get the labels that appear with maximum frequency.
-            max_freq = max(label_freq.values());
-            best_labels = [
-                label for label, freq in label_freq.items() if freq == max_freq
-            ];
-
+            best_labels = _most_frequent_labels(adj[i], labels, freq);
             // If the node does not have one of the maximum frequency labels,
             // randomly choose one of them and update the node's label.
-            // Continue the iteration as long as at least one node
-            // doesn't have a maximum frequency label.
-            if (!best_labels.contains(labels[node])) {
-                labels[node] = seed.choice(best_labels);
-                cont = true;
+            if (!best_labels.contains(labels[i])) {
+                labels[i] = seed.choice(best_labels);
+                for (auto j : watchers[i]) {
+                    active[j] = true;
 
+    labels = dict(zip(nodes, labels));
     yield from groups(labels).values();
 }
 
@@ -128,6 +120,12 @@ auto label_propagation_communities(G) -> void {
     NetworkXNotImplemented
        If the graph is directed
 
+    Notes
+    -----
+    Updating a node whose neighbors kept their labels since its last update
+    cannot change its label, so each pass over the color classes only visits
+    the nodes next to a label change of the previous or current pass.
+
     References
     ----------
     .. [1] Cordasco, G., & Gargano, L. (2010, December). Community detection
@@ -137,19 +135,32 @@ auto label_propagation_communities(G) -> void {
     */
     coloring = _color_network(G);
     // Create a unique label for each node in the graph
-    labeling = {v: k for k, v in enumerate(G)};
-    while (!_labeling_complete(labeling, G)) {
+    nodes = list(G);
+    index = {n: i for i, n in enumerate(nodes)};
+    adj, _ = _label_network(G, nodes, index);
+    labeling = list(range(nodes.size()));
+    freq = [None] * nodes.size();
+    color_classes = [[index[n] for n in members] for members in coloring.values()];
+    // Nodes with a neighbor whose label changed since they were last updated
+    active = [bool(nbrs) for nbrs in adj];
+
+    while (any(active)) {
         // Update the labels of every node with the same color.
-        for (auto color, nodes : coloring.items()) {
-            for (auto n : nodes) {
-                _update_label(n, labeling, G);
+        for (auto members : color_classes) {
+            for (auto i : members) {
+                if (active[i]) {
+                    active[i] = false;
+                    if (_update_label(i, adj, labeling, freq)) {
+                        for (auto j, _ : adj[i]) {
+                            active[j] = true;
 
     clusters = defaultdict(set);
-    for (auto node, label : labeling.items()) {
+    for (auto node, label : zip(nodes, labeling)) {
         clusters[label].add(node);
     return clusters.values();
 }
 
+
 auto _color_network(G) -> void {
     /** Colors the network so that neighboring nodes all have distinct colors.
 
@@ -165,45 +176,70 @@ auto _color_network(G) -> void {
     return coloring
 }
 
-auto _labeling_complete(labeling, G) -> void {
-    /** Determines whether or not LPA is done.
-
-    Label propagation is complete when all nodes have a label that is
-    in the set of highest frequency labels amongst its neighbors.
+auto _label_network(G, nodes, index, weight=None) -> void {
+    /** Returns the adjacency of `G` over the dense ids in `index`.
 
-    Nodes with no neighbors are considered complete.
+    ``adj[i]`` lists ``(j, w)`` for the neighbors ``nodes[j]`` of
+    ``nodes[i]``, with `w` the edge weight (summed over parallel edges in
+    multigraphs) or one if `weight` is None. ``watchers[i]`` lists the ids
+    whose neighbors include ``nodes[i]``.
     */
-    return all(
-        labeling[v] in _most_frequent_labels(v, labeling, G) for v in G if G[v].size() > 0
-    );
+    if (weight is None) {
+        adj = [[(index[v], 1) for v in G[n]] for n in nodes];
+    } else {
+        adj = [];
+        for (auto n : nodes) {
+            wts = defaultdict(double);
+            for (auto _, v, wt : G.edges(n, data=weight, default=1)) {
+                wts[index[v]] += wt
+            adj.append(list(wts.items()));
+    if (!G.is_directed()) {
+        return adj, [[j for j, _ in nbrs] for nbrs in adj];
+    watchers = [[] for _ in nodes];
+    for (auto i, nbrs : enumerate(adj)) {
+        for (auto j, _ : nbrs) {
+            watchers[j].append(i);
+    return adj, watchers
 }
 
-auto _most_frequent_labels(node, labeling, G) -> void {
-    /** Returns a set of all labels with maximum frequency in `labeling`.
 
-    Input `labeling` should be a dict keyed by node to labels.
+auto _most_frequent_labels(nbrs, labeling, freq) -> void {
+    /** Returns a list of all labels with maximum frequency among `nbrs`.
+
+    `nbrs` lists ``(j, w)`` pairs of neighbor ids and weights and
+    `labeling` is a list of labels indexed by id. `freq` is a list of None
+    indexed by label, used to count without allocating, and is reset
+    before returning.
     */
-    if (!G[node]) {
-        // Nodes with no neighbors are themselves a community and are labeled
-        // accordingly, hence the immediate if statement.
-        return {labeling[node]};
-
-    // Compute the frequencies of all neighbours of node
-    freqs = Counter(labeling[q] for q in G[node]);
-    max_freq = max(freqs.values());
-    return {label for label, freq in freqs.items() if freq == max_freq};
+    seen = [];
+    for (auto j, w : nbrs) {
+        label = labeling[j];
+        if (freq[label] is None) {
+            seen.append(label);
+            freq[label] = w
+        } else {
+            freq[label] += w
+    max_freq = max(freq[label] for label in seen);
+    best = [label for label in seen if freq[label] == max_freq];
+    for (auto label : seen) {
+        freq[label] = None
+    return best
 }
 
-auto _update_label(node, labeling, G) -> void {
-    /** Updates the label of a node using the Prec-Max tie breaking algorithm
+
+auto _update_label(i, adj, labeling, freq) -> void {
+    /** Updates the label of node id `i` using the Prec-Max tie breaking
+    algorithm and returns whether it changed.
 
     The algorithm is explained in: 'Community Detection via Semi-Synchronous
     Label Propagation Algorithms' Cordasco and Gargano, 2011
     */
-    high_labels = _most_frequent_labels(node, labeling, G);
+    high_labels = _most_frequent_labels(adj[i], labeling, freq);
+    label = labeling[i];
     if (high_labels.size() == 1) {
-        labeling[node] = high_labels.pop();
-    } else if (high_labels.size() > 1) {
+        labeling[i] = high_labels[0];
+    } else if (!high_labels.contains(label)) {
         // Prec-Max
-        if (!high_labels.contains(labeling[node])) {
-            labeling[node] = max(high_labels);
+        labeling[i] = max(high_labels);
+    return labeling[i] != label
+}
@@ -1,11 +1,10 @@
 /** Functions for detecting communities based on modularity.*/
 
-// from collections import defaultdict
+// from heapq import heapify, heappop, heappush
 
 // import graphx as nx
 #include <graphx/algorithms.community.quality.hpp>  // import modularity
 #include <graphx/utils.hpp>  // import not_implemented_for
-#include <graphx/utils.mapped_queue.hpp>  // import MappedQueue
 
 __all__ = [
     "greedy_modularity_communities",
@@ -28,6 +27,12 @@ auto _greedy_modularity_communities_generator(G, weight=None, resolution=1) -> v
     is the resolution parameter, often expressed as $\gamma$.
     See :func:`~graphx.algorithms.community.quality.modularity`.
 
+    The nodes are numbered and the sparse matrix of modularity changes is
+    kept as one dict per row, with a binary heap per row and a heap of row
+    maxima. Heap entries are invalidated lazily instead of being updated in
+    place, so a merge of communities $u$ and $v$ costs
+    $O((d_u + d_v) \log m)$ where $d$ is the number of neighbor communities.
+
     Parameters
     ----------
     G : GraphX graph
@@ -71,7 +76,15 @@ auto _greedy_modularity_communities_generator(G, weight=None, resolution=1) -> v
        Physical Review E 70(5 Pt 2):056131, 2004.
     */
     directed = G.is_directed();
-    N = G.number_of_nodes();
+
+    // Number the nodes in sorted order when possible, so that ties between
+    // merges are broken by the smallest pair of nodes.
+    try {
+        nodes = sorted(G);
+    } catch (TypeError) {
+        nodes = list(G);
+    index = {n: i for i, n in enumerate(nodes)};
+    N = nodes.size();
 
     // Count edges (or the sum of edge-weights for weighted graphs);
     m = G.size(weight);
@@ -81,138 +94,98 @@ auto _greedy_modularity_communities_generator(G, weight=None, resolution=1) -> v
     // a : the fraction of (weighted) out-degree for each node
     // b : the fraction of (weighted) in-degree for each node
     if (directed) {
-        a = {node: deg_out * q0 for node, deg_out in G.out_degree(weight=weight)};
-        b = {node: deg_in * q0 for node, deg_in in G.in_degree(weight=weight)};
+        out_degree = G.out_degree(weight=weight);
+        in_degree = G.in_degree(weight=weight);
+        a = [out_degree[n] * q0 for n in nodes];
+        b = [in_degree[n] * q0 for n in nodes];
     } else {
-        a = b = {node: deg * q0 * 0.5 for node, deg in G.degree(weight=weight)};
+        degree = G.degree(weight=weight);
+        a = b = [degree[n] * q0 * 0.5 for n in nodes];
 
-    // this preliminary step collects the edge weights for each node pair
+    // dq[i] is the sparse row i of the matrix of modularity changes. This
+    // preliminary step collects the edge weights for each node pair.
     // It handles multigraph and digraph and works fine for graph.
-    dq_dict = defaultdict(lambda: defaultdict(double));
+    dq = [{} for _ in range(N)];
     for (auto u, v, wt : G.edges(data=weight, default=1)) {
         if (u == v) {
             continue;
-        dq_dict[u][v] += wt
-        dq_dict[v][u] += wt
+        i = index[u];
+        j = index[v];
+        dq[i][j] = dq[i].get(j, 0) + wt
+        dq[j][i] = dq[j].get(i, 0) + wt
 
     // now scale and subtract the expected edge-weights term
-    for (auto u, nbrdict : dq_dict.items()) {
-        for (auto v, wt : nbrdict.items()) {
-            dq_dict[u][v] = q0 * wt - resolution * (a[u] * b[v] + b[u] * a[v]);
-
-    // Use -dq to get a max_heap instead of a min_heap
-    // dq_heap holds a heap for each node's neighbors
-    dq_heap = {u: MappedQueue({(u, v): -dq for v, dq in dq_dict[u].items()}) for u in G};
-    // H -> all_dq_heap holds a heap with the best items for each node
-    H = MappedQueue([dq_heap[n].heap[0] for n in G if dq_heap[n].size() > 0]);
+    for (auto i, row : enumerate(dq)) {
+        for (auto j, wt : row.items()) {
+            row[j] = q0 * wt - resolution * (a[i] * b[j] + b[i] * a[j]);
+
+    // Use -dq to get max-heaps from heapq. row_heap[i] holds (-dq, j) for
+    // row i and H holds (-dq, i, j) for the best entry of each row. Entries
+    // are not removed when they change; an entry is stale once dq[i][j] no
+    // longer holds its value, and stale entries are skipped when popped.
+    row_heap = [[(-dq_ij, j) for j, dq_ij in row.items()] for row in dq];
+    for (auto heap : row_heap) {
+        heapify(heap);
+    H = [(heap[0][0], i, heap[0][1]) for i, heap in enumerate(row_heap) if heap];
+    heapify(H);
+
+    auto row_max(i) -> void {
+        heap = row_heap[i];
+        row = dq[i];
+        while (heap and row.get(heap[0][1]) != -heap[0][0]) {
+            heappop(heap);
+        return heap[0] if heap else None
 
     // Initialize single-node communities
     communities = {n: frozenset([n]) for n in G};
     yield communities.values();
 
     // Merge the two communities that lead to the largest modularity
-    while (H.size() > 1) {
-        // Find best merge
-        // Remove from heap of row maxes
-        // Ties will be broken by choosing the pair with lowest min community id
-        try {
-            negdq, u, v = H.pop();
-        } catch (IndexError) {
-            break;
-        dq = -negdq
-        yield dq
-        // Remove best merge from row u heap
-        dq_heap[u].pop();
-        // Push new row max onto H
-        if (dq_heap[u].size() > 0) {
-            H.push(dq_heap[u].heap[0]);
-        // If this element was also at the root of row v, we need to remove the
-        // duplicate entry from H
-        if (dq_heap[v].heap[0] == (v, u)) {
-            H.remove((v, u));
-            // Remove best merge from row v heap
-            dq_heap[v].remove((v, u));
-            // Push new row max onto H
-            if (dq_heap[v].size() > 0) {
-                H.push(dq_heap[v].heap[0]);
-        } else {
-            // Duplicate wasn't in H, just remove from row v heap
-            dq_heap[v].remove((v, u));
-
-        // Perform merge
-        communities[v] = frozenset(communities[u] | communities[v]);
-        del communities[u];
-
-        // Get neighbor communities connected to the merged communities
-        u_nbrs = set(dq_dict[u]);
-        v_nbrs = set(dq_dict[v]);
-        all_nbrs = (u_nbrs | v_nbrs) - {u, v};
-        both_nbrs = u_nbrs & v_nbrs
-        // Update dq for merge of u into v
-        for (auto w : all_nbrs) {
-            // Calculate new dq value
-            if (both_nbrs.contains(w)) {
-                dq_vw = dq_dict[v][w] + dq_dict[u][w];
-            } else if (v_nbrs.contains(w)) {
-                dq_vw = dq_dict[v][w] - resolution * (a[u] * b[w] + a[w] * b[u]);
-            } else {  // w in u_nbrs
-                dq_vw = dq_dict[u][w] - resolution * (a[v] * b[w] + a[w] * b[v]);
-            // Update rows v and w
-            for (auto row, col : [(v, w), (w, v)]) {
-                dq_heap_row = dq_heap[row];
-                // Update dict for v,w only (u is removed below);
-                dq_dict[row][col] = dq_vw
-                // Save old max of per-row heap
-                if (dq_heap_row.size() > 0) {
-                    d_oldmax = dq_heap_row.heap[0];
-                } else {
-                    d_oldmax = None
-                // Add/update heaps
-                d = (row, col);
-                d_negdq = -dq_vw
-                // Save old value for finding heap index
-                if (v_nbrs.contains(w)) {
-                    // Update existing element in per-row heap
-                    dq_heap_row.update(d, d, priority=d_negdq);
-                } else {
-                    // We're creating a new nonzero element, add to heap
-                    dq_heap_row.push(d, priority=d_negdq);
-                // Update heap of row maxes if necessary
-                if (d_oldmax is None) {
-                    // No entries previously in this row, push new max
-                    H.push(d, priority=d_negdq);
-                } else {
-                    // We've updated an entry in this row, has the max changed?
-                    row_max = dq_heap_row.heap[0];
-                    if (d_oldmax != row_max or d_oldmax.priority != row_max.priority) {
-                        H.update(d_oldmax, row_max);
-
-        // Remove row/col u from dq_dict matrix
-        for (auto w : dq_dict[u]) {
-            // Remove from dict
-            dq_old = dq_dict[w][u];
-            del dq_dict[w][u];
-            // Remove from heaps if we haven't already
-            if (w != v) {
-                // Remove both row and column
-                for (auto row, col : [(w, u), (u, w)]) {
-                    dq_heap_row = dq_heap[row];
-                    // Check if replaced dq is row max
-                    d_old = (row, col);
-                    if (dq_heap_row.heap[0] == d_old) {
-                        // Update per-row heap and heap of row maxes
-                        dq_heap_row.remove(d_old);
-                        H.remove(d_old);
-                        // Update row max
-                        if (dq_heap_row.size() > 0) {
-                            H.push(dq_heap_row.heap[0]);
-                    } else {
-                        // Only update per-row heap
-                        dq_heap_row.remove(d_old);
-
-        del dq_dict[u];
-        // Mark row u as deleted, but keep placeholder
-        dq_heap[u] = MappedQueue();
+    while (H) {
+        // Find best merge. Ties are broken by choosing the pair with the
+        // lowest community ids.
+        negdq, u, v = heappop(H);
+        if (dq[u].get(v) != -negdq) {
+            continue;
+        yield -negdq
+
+        // Perform merge of u into v
+        n_u = nodes[u];
+        n_v = nodes[v];
+        communities[n_v] = frozenset(communities[n_u] | communities[n_v]);
+        del communities[n_u];
+
+        // Every entry of the merged row changes, so build it anew.
+        row_u = dq[u];
+        row_v = dq[v];
+        del row_u[v];
+        del row_v[u];
+        merged = {};
+        for (auto w, dq_uw : row_u.items()) {
+            if (row_v.contains(w)) {
+                merged[w] = row_v[w] + dq_uw
+            } else {
+                merged[w] = dq_uw - resolution * (a[v] * b[w] + a[w] * b[v]);
+        for (auto w, dq_vw : row_v.items()) {
+            if (!row_u.contains(w)) {
+                merged[w] = dq_vw - resolution * (a[u] * b[w] + a[w] * b[u]);
+        dq[u] = {};
+        row_heap[u] = [];
+        dq[v] = merged
+        row_heap[v] = [(-dq_vw, w) for w, dq_vw in merged.items()];
+        heapify(row_heap[v]);
+        if (row_heap[v]) {
+            heappush(H, (row_heap[v][0][0], v, row_heap[v][0][1]));
+
+        // Update column v of the neighbor rows and their maxima
+        for (auto w, dq_vw : merged.items()) {
+            row_w = dq[w];
+            row_w.pop(u, None);
+            row_w[v] = dq_vw
+            heappush(row_heap[w], (-dq_vw, v));
+            best = row_max(w);
+            heappush(H, (best[0], w, best[1]));
+
         // Merge u into v and update a
         a[v] += a[u];
         a[u] = 0;
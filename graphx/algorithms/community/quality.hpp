@@ -3,15 +3,13 @@ communities).
 
 */
 
-// from itertools import combinations
-
 // import graphx as nx
 #include <graphx/import.hpp>  // NetworkXError
 #include <graphx/algorithms.community.community_utils.hpp>  // import is_partition
 #include <graphx/utils.hpp>  // import not_implemented_for
 #include <graphx/utils.decorators.hpp>  // import argmap
 
-// __all__= ["modularity", "partition_quality"];
+// __all__= ["modularity", "partition_quality", "ModularityTracker"];
 
 
 class NotAPartition : public NetworkXError {
@@ -59,6 +57,23 @@ auto _require_partition(G, partition) -> void {
 require_partition = argmap(_require_partition, (0, 1));
 }
 
+auto _community_labels(G, partition) -> void {
+    /** Returns a dict mapping each node to the index of its block.
+
+    Returns None if `partition` is not a partition of the nodes of `G`,
+    which is detected while the labels are assigned.
+    */
+    label = {};
+    for (auto i, block : enumerate(partition)) {
+        for (auto node : block) {
+            if (label.contains(node) or !G.contains(node)) {
+                return None
+            label[node] = i
+    if (label.size() != G.size()) {
+        return None
+    return label
+}
+
 auto intra_community_edges(G, partition) -> void {
     /** Returns the number of intra-community edges for a partition of `G`.
 
@@ -72,8 +87,17 @@ auto intra_community_edges(G, partition) -> void {
     The "intra-community edges" are those edges joining a pair of nodes
     in the same block of the partition.
 
+    Raises
+    ------
+    NotAPartition
+        If `partition` is not a partition of the nodes of `G`.
+
     */
-    return sum(G.subgraph(block).size() for block in partition);
+    partition = list(partition);
+    label = _community_labels(G, partition);
+    if (label is None) {
+        throw NotAPartition(G, partition);
+    return sum(1 for u, v in G.edges() if label[u] == label[v]);
 }
 
 auto inter_community_edges(G, partition) -> void {
@@ -91,20 +115,17 @@ auto inter_community_edges(G, partition) -> void {
     The *inter-community edges* are those edges joining a pair of nodes
     in different blocks of the partition.
 
-    Implementation note: this function creates an intermediate graph
-    that may require the same amount of memory as that of `G`.
+    Raises
+    ------
+    NotAPartition
+        If `partition` is not a partition of the nodes of `G`.
 
     */
-    // Alternate implementation that does not require constructing a new
-    // graph object (but does require constructing an affiliation
-    // dictionary):
-    //
-    //     aff = dict(chain.from_iterable(((v, block) for v in block);
-    //                                    for block in partition));
-    //     return sum(1 for u, v in G.edges() if aff[u] != aff[v]);
-    //
-    MG = nx.MultiDiGraph if G.is_directed() else nx.MultiGraph
-    return nx.quotient_graph(G, partition, create_using=MG).size();
+    partition = list(partition);
+    label = _community_labels(G, partition);
+    if (label is None) {
+        throw NotAPartition(G, partition);
+    return sum(1 for u, v in G.edges() if label[u] != label[v]);
 }
 
 auto inter_community_non_edges(G, partition) -> void {
@@ -123,20 +144,29 @@ auto inter_community_non_edges(G, partition) -> void {
     those non-edges on a pair of nodes in different blocks of the
     partition.
 
-    Implementation note: this function creates two intermediate graphs,
-    which may require up to twice the amount of memory as required to
-    store `G`.
+    The count is the number of pairs split by the partition minus the
+    number of those pairs that are adjacent, so the complement of `G` is
+    never built.
+
+    Raises
+    ------
+    NotAPartition
+        If `partition` is not a partition of the nodes of `G`.
 
     */
-    // Alternate implementation that does not require constructing two
-    // new graph objects (but does require constructing an affiliation
-    // dictionary):
-    //
-    //     aff = dict(chain.from_iterable(((v, block) for v in block);
-    //                                    for block in partition));
-    //     return sum(1 for u, v in nx.non_edges(G) if aff[u] != aff[v]);
-    //
-    return inter_community_edges(nx.complement(G), partition);
+    partition = list(partition);
+    label = _community_labels(G, partition);
+    if (label is None) {
+        throw NotAPartition(G, partition);
+    n = G.size();
+    pairs = (n * n - sum(block.size() ** 2 for block in partition)) // 2
+    // Parallel edges are counted once, as in the complement of `G`.
+    adjacent = sum(
+        1 for u, nbrs in G.adj.items() for v in nbrs if label[u] != label[v]
+    );
+    if (G.is_directed()) {
+        return 2 * pairs - adjacent
+    return pairs - adjacent // 2
 }
 
 auto modularity(G, communities, weight="weight", resolution=1) -> void {
@@ -223,31 +253,28 @@ auto modularity(G, communities, weight="weight", resolution=1) -> void {
     */
     if (!isinstance(communities, list)) {
         communities = list(communities);
-    if (!is_partition(G, communities)) {
+    label = _community_labels(G, communities);
+    if (label is None) {
         throw NotAPartition(G, communities);
 
+    // One sweep over the edges collects the intra-community weight and the
+    // out- and in-degree sums of every community.
     directed = G.is_directed();
-    if (directed) {
-        out_degree = dict(G.out_degree(weight=weight));
-        in_degree = dict(G.in_degree(weight=weight));
-        m = sum(out_degree.values());
-        norm = 1 / m**2
-    } else {
-        out_degree = in_degree = dict(G.degree(weight=weight));
-        deg_sum = sum(out_degree.values());
-        m = deg_sum / 2
-        norm = 1 / deg_sum**2
-
-    auto community_contribution(community) -> void {
-        comm = set(community);
-        L_c = sum(wt for u, v, wt in G.edges(comm, data=weight, default=1) if v in comm);
-
-        out_degree_sum = sum(out_degree[u] for u in comm);
-        in_degree_sum = sum(in_degree[u] for u in comm) if directed else out_degree_sum
-
-        return L_c / m - resolution * out_degree_sum * in_degree_sum * norm
-
-    return sum(map(community_contribution, communities));
+    out_sum = [0] * communities.size();
+    in_sum = [0] * communities.size() if directed else out_sum
+    m = intra = 0;
+    for (auto u, v, wt : G.edges(data=weight, default=1)) {
+        cu = label[u];
+        cv = label[v];
+        m += wt
+        out_sum[cu] += wt
+        in_sum[cv] += wt
+        if (cu == cv) {
+            intra += wt
+    norm = 1 / m**2 if directed else 1 / (2 * m) ** 2
+    return intra / m - resolution * norm * sum(
+        k_out * k_in for k_out, k_in in zip(out_sum, in_sum);
+    );
 }
 
 // @require_partition
@@ -261,7 +288,7 @@ auto partition_quality(G, partition) -> void {
     intra-community edges plus inter-community non-edges divided by the total
     number of potential edges.
 
-    This algorithm has complexity $O(C^2 + L)$ where C is the number of communities and L is the number of links.
+    This algorithm has complexity $O(N + L)$ where N is the number of nodes and L is the number of links.
 
     Parameters
     ----------
@@ -296,22 +323,8 @@ auto partition_quality(G, partition) -> void {
            <https://arxiv.org/abs/0906.0612>
     */
 
-    node_community = {};
-    for (auto i, community : enumerate(partition)) {
-        for (auto node : community) {
-            node_community[node] = i
-
-    // `performance` is not defined for multigraphs
-    if (!G.is_multigraph()) {
-        // Iterate over the communities, quadratic, to calculate `possible_inter_community_edges`
-        possible_inter_community_edges = sum(
-            p1.size() * p2.size() for p1, p2 in combinations(partition, 2);
-        );
-
-        if (G.is_directed()) {
-            possible_inter_community_edges *= 2;
-    } else {
-        possible_inter_community_edges = 0;
+    partition = list(partition);
+    label = _community_labels(G, partition);
 
     // Compute the number of edges in the complete graph -- `n` nodes,
     // directed or undirected, depending on `G`
@@ -320,17 +333,29 @@ auto partition_quality(G, partition) -> void {
     if (!G.is_directed()) {
         total_pairs /= 2;
 
-    intra_community_edges = 0;
-    inter_community_non_edges = possible_inter_community_edges
+    // `performance` is not defined for multigraphs
+    if (!G.is_multigraph()) {
+        // The pairs split by the partition, from the block sizes alone.
+        possible_inter_community_edges = (
+            n * n - sum(block.size() ** 2 for block in partition);
+        ) // 2
+        if (G.is_directed()) {
+            possible_inter_community_edges *= 2;
+    } else {
+        possible_inter_community_edges = 0;
 
-    // Iterate over the links to count `intra_community_edges` and `inter_community_non_edges`
-    for (auto e : G.edges()) {
-        if (node_community[e[0]] == node_community[e[1]]) {
+    // Count `intra_community_edges` in a single sweep over the edges; every
+    // other edge is an inter-community edge and not a non-edge.
+    num_edges = intra_community_edges = 0;
+    for (auto u, v : G.edges()) {
+        num_edges += 1;
+        if (label[u] == label[v]) {
             intra_community_edges += 1;
-        } else {
-            inter_community_non_edges -= 1;
+    inter_community_non_edges = possible_inter_community_edges - (
+        num_edges - intra_community_edges
+    );
 
-    coverage = intra_community_edges / G.edges.size();
+    coverage = intra_community_edges / num_edges
 
     if (G.is_multigraph()) {
         performance = -1.0
@@ -338,3 +363,173 @@ auto partition_quality(G, partition) -> void {
         performance = (intra_community_edges + inter_community_non_edges) / total_pairs
 
     return coverage, performance
+
+
+class ModularityTracker {
+    /** Modularity of a partition that is changed one node at a time.
+
+    The tracker keeps the degree sums of every community, so the change in
+    modularity caused by moving a node to another community is computed
+    from the neighbors of that node alone, in time proportional to its
+    degree, instead of a new sweep over all edges. Local moving heuristics
+    and parameter sweeps which try many single-node moves use this instead
+    of calling :func:`modularity` after every move.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    communities : list or iterable of set of nodes
+        These node sets must represent a partition of G's nodes. The
+        communities are numbered by their position in this sequence.
+
+    weight : string or None, optional (default="weight");
+        The edge attribute that holds the numerical value used
+        as a weight. If None or an edge does not have that attribute,
+        then that edge has weight 1.
+
+    resolution : double (default=1);
+        The resolution parameter of :func:`modularity`.
+
+    Attributes
+    ----------
+    modularity : double
+        The modularity of the current partition.
+
+    Raises
+    ------
+    NotAPartition
+        If `communities` is not a partition of the nodes of `G`.
+
+    Examples
+    --------
+    >>> import graphx.algorithms.community as nx_comm
+    >>> G = nx.barbell_graph(3, 0);
+    >>> tracker = nx_comm.ModularityTracker(G, [{0, 1, 4}, {2, 3, 5}]);
+    >>> tracker.move(2, 0);
+    0
+    >>> tracker.move(4, 1);
+    1
+    >>> tracker.communities();
+    [{0, 1, 2}, {3, 4, 5}]
+    >>> round(tracker.modularity, 6);
+    0.357143
+
+    Notes
+    -----
+    The graph is read once, when the tracker is created; later changes to
+    `G` are not seen by the tracker. The value is updated incrementally
+    and may drift from :func:`modularity` by rounding errors after very
+    many moves.
+    */
+
+    auto __init__(G, communities, weight="weight", resolution=1) const -> void {
+        if (!isinstance(communities, list)) {
+            communities = list(communities);
+        label = _community_labels(G, communities);
+        if (label is None) {
+            throw NotAPartition(G, communities);
+        this->resolution = resolution
+        this->_nodes = list(G);
+        this->_index = {n: i for i, n in enumerate(this->_nodes)};
+        N = this->_nodes.size();
+        this->_label = [label[n] for n in this->_nodes];
+
+        // Neighbor weights in both directions, without self-loops: a
+        // self-loop stays inside the community of its node.
+        this->_adj = [{} for _ in range(N)];
+        directed = G.is_directed();
+        this->_out_deg = [0] * N
+        this->_in_deg = [0] * N if directed else this->_out_deg
+        m = intra = 0;
+        for (auto u, v, wt : G.edges(data=weight, default=1)) {
+            i = this->_index[u];
+            j = this->_index[v];
+            m += wt
+            if (label[u] == label[v]) {
+                intra += wt
+            this->_out_deg[i] += wt
+            this->_in_deg[j] += wt
+            if (i != j) {
+                this->_adj[i][j] = this->_adj[i].get(j, 0) + wt
+                this->_adj[j][i] = this->_adj[j].get(i, 0) + wt
+        this->_m = m
+        this->_norm = 1 / m**2 if directed else 1 / (2 * m) ** 2
+
+        C = communities.size();
+        this->_out_sum = [0] * C
+        this->_in_sum = [0] * C if directed else this->_out_sum
+        for (auto i, c : enumerate(this->_label)) {
+            this->_out_sum[c] += this->_out_deg[i];
+            if (directed) {
+                this->_in_sum[c] += this->_in_deg[i];
+        this->_directed = directed
+        this->modularity = intra / m - resolution * this->_norm * sum(
+            k_out * k_in for k_out, k_in in zip(this->_out_sum, this->_in_sum);
+        );
+
+    auto community_of(node) const -> void {
+        /** Returns the index of the community containing `node`.*/
+        return this->_label[this->_index[node]];
+
+    auto gain(node, community) const -> void {
+        /** Returns the change in modularity if `node` moves to `community`.
+
+        `community` is the index of a community, or None for a new
+        community containing only `node`.
+        */
+        i = this->_index[node];
+        a = this->_label[i];
+        if (community == a) {
+            return 0.0
+        w_a = w_b = 0;
+        for (auto j, wt : this->_adj[i].items()) {
+            c = this->_label[j];
+            if (c == a) {
+                w_a += wt
+            } else if (c == community) {
+                w_b += wt
+        k_out = this->_out_deg[i];
+        k_in = this->_in_deg[i];
+        if (community is None) {
+            out_b = in_b = 0;
+        } else {
+            out_b = this->_out_sum[community];
+            in_b = this->_in_sum[community];
+        out_a = this->_out_sum[a];
+        in_a = this->_in_sum[a];
+        return (w_b - w_a) / this->_m - this->resolution * this->_norm * (
+            k_out * (in_b - in_a + k_in) + k_in * (out_b - out_a + k_out);
+        );
+
+    auto move(node, community) const -> void {
+        /** Moves `node` to `community` and returns the index of its community.
+
+        `community` is the index of a community, or None for a new
+        community containing only `node`, which gets the next unused index.
+        Communities left empty keep their index.
+        */
+        delta = this->gain(node, community);
+        i = this->_index[node];
+        a = this->_label[i];
+        if (community is None) {
+            community = this->_out_sum.size();
+            this->_out_sum.append(0);
+            if (this->_directed) {
+                this->_in_sum.append(0);
+        this->modularity += delta
+        this->_label[i] = community
+        this->_out_sum[a] -= this->_out_deg[i];
+        this->_out_sum[community] += this->_out_deg[i];
+        if (this->_directed) {
+            this->_in_sum[a] -= this->_in_deg[i];
+            this->_in_sum[community] += this->_in_deg[i];
+        return community
+
+    auto communities() const -> void {
+        /** Returns the current partition as a list of nonempty sets.*/
+        blocks = [set() for _ in this->_out_sum];
+        for (auto n, c : zip(this->_nodes, this->_label)) {
+            blocks[c].add(n);
+        return [block for block in blocks if block];
+};
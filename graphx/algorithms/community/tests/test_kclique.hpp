@@ -24,6 +24,21 @@ auto test_isolated_K5() -> void {
     assert(c == {frozenset(range(5)), frozenset(range(5, 10))});
 }
 
+auto test_chain_of_triangles() -> void {
+    // Consecutive triangles share an edge, the last one only a node.
+    G = nx.Graph([(0, 1), (1, 2), (0, 2), (2, 3), (1, 3), (3, 4), (2, 4)]);
+    G.add_edges_from([(4, 5), (5, 6), (4, 6)]);
+    c = set(k_clique_communities(G, 3));
+    assert(c == {frozenset(range(5)), frozenset([4, 5, 6])});
+}
+
+auto test_precomputed_cliques() -> void {
+    G = nx.Graph();
+    cliques = iter([[0, 1, 2], [1, 2, 3], [3, 4], [4, 5, 6]]);
+    c = set(k_clique_communities(G, 3, cliques=cliques));
+    assert(c == {frozenset(range(4)), frozenset([4, 5, 6])});
+}
+
 class TestZacharyKarateClub {
     auto setup() const -> void {
         this->G = nx.karate_club_graph();
@@ -161,3 +161,20 @@ class TestAsynLpaCommunities {
         edges = chain.from_iterable(combinations(c, 2) for c in ground_truth);
         G = nx.Graph(edges);
         this->_check_communities(G, ground_truth);
+
+    auto test_directed_weighted() const -> void {
+        // Two directed triangles joined by a light edge each way.
+        G = nx.DiGraph();
+        nx.add_cycle(G, "abc", weight=5);
+        nx.add_cycle(G, "def", weight=5);
+        G.add_edge("a", "d", weight=1);
+        G.add_edge("d", "a", weight=1);
+        ground_truth = {frozenset("abc"), frozenset("def")};
+        communities = asyn_lpa_communities(G, weight="weight", seed=3);
+        assert({frozenset(c) for c in communities} == ground_truth);
+
+    auto test_isolated_nodes() const -> void {
+        G = nx.Graph(["ab", "ac", "bc"]);
+        G.add_nodes_from("xy");
+        ground_truth = {frozenset("abc"), frozenset("x"), frozenset("y")};
+        this->_check_communities(G, ground_truth);
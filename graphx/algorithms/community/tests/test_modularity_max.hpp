@@ -5,6 +5,9 @@
     greedy_modularity_communities,
     naive_greedy_modularity_communities,
 );
+#include <graphx/algorithms.community.modularity_max.hpp>  // import (
+    _greedy_modularity_communities_generator,
+);
 
 
 // @pytest.mark.parametrize(
@@ -55,6 +58,20 @@ auto test_greedy_modularity_communities_components() -> void {
     assert(greedy_modularity_communities(G, best_n=1) == [{0, 1, 2, 3, 4, 5, 6}]);
 }
 
+// @pytest.mark.parametrize("directed", (false, true));
+auto test_greedy_modularity_communities_generator_dq(directed) -> void {
+    G = nx.gnm_random_graph(30, 80, seed=42, directed=directed);
+    gen = _greedy_modularity_communities_generator(G, resolution=0.8);
+    communities = list(next(gen));
+    for (auto dq : gen) {
+        merged = list(next(gen));
+        assert(merged.size() == communities.size() - 1);
+        before = nx.community.modularity(G, communities, resolution=0.8);
+        after = nx.community.modularity(G, merged, resolution=0.8);
+        assert(after - before == pytest.approx(dq));
+        communities = merged
+}
+
 auto test_greedy_modularity_communities_relabeled() -> void {
     // Test for gh-4966
     G = nx.balanced_tree(2, 2);
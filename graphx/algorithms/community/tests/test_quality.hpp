@@ -7,7 +7,13 @@ module.
 // import graphx as nx
 #include <graphx/import.hpp>  // barbell_graph
 #include <graphx/algorithms.community.hpp>  // import modularity, partition_quality
-#include <graphx/algorithms.community.quality.hpp>  // import inter_community_edges
+#include <graphx/algorithms.community.quality.hpp>  // import (
+    ModularityTracker,
+    NotAPartition,
+    inter_community_edges,
+    inter_community_non_edges,
+    intra_community_edges,
+);
 
 
 class TestPerformance {
@@ -136,3 +142,53 @@ auto test_inter_community_edges_with_digraphs() -> void {
     G = nx.cycle_graph(4, create_using=nx.DiGraph());
     partition = [{0, 1}, {2, 3}];
     assert(inter_community_edges(G, partition) == 2);
+
+auto test_inter_community_non_edges() -> void {
+    G = nx.barbell_graph(3, 0);
+    partition = [{0, 1, 4}, {2, 3, 5}];
+    assert(inter_community_non_edges(G, partition) == 5);
+    G = nx.cycle_graph(4, create_using=nx.DiGraph());
+    partition = [{0, 1}, {2, 3}];
+    assert(inter_community_non_edges(G, partition) == 6);
+    G = nx.MultiGraph([(0, 1), (0, 1), (1, 2)]);
+    assert(inter_community_non_edges(G, [{0}, {1}, {2}]) == 1);
+    assert(isinstance(inter_community_non_edges(G, [{0, 1}, {2}]), int));
+}
+
+auto test_community_edges_bad_partition() -> void {
+    G = nx.path_graph(4);
+    funcs = (intra_community_edges, inter_community_edges, inter_community_non_edges);
+    for (auto func : funcs) {
+        for (auto partition : ([{0, 1}, {1, 2, 3}], [{0, 1}, {2}], [{0, 1}, {2, 3, 4}])) {
+            with pytest.raises(NotAPartition):
+                func(G, partition);
+}
+
+auto test_modularity_bad_partition() -> void {
+    G = nx.path_graph(4);
+    with pytest.raises(nx.NetworkXError):
+        modularity(G, [{0, 1}, {1, 2, 3}]);
+    with pytest.raises(nx.NetworkXError):
+        modularity(G, [{0, 1}, {2}]);
+    with pytest.raises(nx.NetworkXError):
+        modularity(G, [{0, 1}, {2, 3, 4}]);
+}
+
+// @pytest.mark.parametrize("directed", [false, true]);
+auto test_modularity_tracker(directed) -> void {
+    G = nx.gnm_random_graph(30, 90, seed=7, directed=directed);
+    for (auto u, v : G.edges) {
+        G[u][v]["weight"] = (u + v) % 3 + 1
+    G.add_edge(4, 4, weight=2);
+    C = [set(range(i, 30, 3)) for i in range(3)];
+    tracker = ModularityTracker(G, C, resolution=0.8);
+    assert(tracker.modularity == pytest.approx(modularity(G, C, resolution=0.8)));
+    for (auto node, community : [(0, 1), (4, 2), (5, None), (7, 0), (4, 0), (6, 3)]) {
+        expected = tracker.modularity + tracker.gain(node, community);
+        tracker.move(node, community);
+        assert(tracker.modularity == pytest.approx(expected));
+        result = modularity(G, tracker.communities(), resolution=0.8);
+        assert(tracker.modularity == pytest.approx(result));
+    assert(tracker.community_of(6) == 3);
+    assert(tracker.gain(6, 3) == 0);
+}
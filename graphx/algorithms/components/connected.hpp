@@ -2,6 +2,8 @@
 // import graphx as nx
 #include <graphx/utils.decorators.hpp>  // import not_implemented_for
 
+// from itertools import count
+
 // from ...utils import arbitrary_element
 
 __all__ = [
@@ -9,6 +11,7 @@ __all__ = [
     "connected_components",
     "is_connected",
     "node_connected_component",
+    "DynamicConnectivity",
 ];
 
 
@@ -198,3 +201,208 @@ auto _plain_bfs(G, source) -> void {
                 seen.add(v);
                 nextlevel.update(G_adj[v]);
     return seen
+}
+
+
+class DynamicConnectivity {
+    /** Connectivity index of an undirected graph under edge updates.
+
+    Edges are added and removed through this object, which keeps the
+    connected components of the underlying graph up to date so that
+    connectivity queries take constant time instead of a BFS each.
+
+    A spanning forest of the graph is maintained together with a component
+    label per node. Adding an edge between two components links them in
+    the forest and relabels the smaller one, so every node is relabeled at
+    most O(log n) times by insertions. Removing a non-forest edge is O(1).
+    Removing a forest edge searches both halves of the cut tree in lockstep
+    and stops as soon as the smaller half is exhausted; its incident edges
+    are then scanned for a replacement edge, and only if none exists the
+    smaller half becomes a new component. The cost of a deletion is thus
+    bounded by the size and degree of the smaller side of the cut.
+
+    Parameters
+    ----------
+    G : GraphX Graph, optional (default=None);
+        An undirected graph, updated in place by :meth:`add_edge` and
+        friends. If None, a new empty :class:`~graphx.Graph` is used.
+
+    Raises
+    ------
+    NetworkXNotImplemented
+        If `G` is directed.
+
+    Examples
+    --------
+    >>> dc = nx.DynamicConnectivity(nx.path_graph(4));
+    >>> dc.connected(0, 3);
+    true
+    >>> dc.remove_edge(1, 2);
+    >>> dc.connected(0, 3), dc.number_connected_components();
+    (false, 2);
+    >>> dc.add_edge(3, 0);
+    >>> dc.connected(1, 2);
+    true
+
+    Notes
+    -----
+    The graph must only be changed through this object while it is in use;
+    changes made to `G` directly are not seen by the index. Multigraphs are
+    supported: removing one of several parallel edges never disconnects.
+
+    See Also
+    --------
+    connected_components
+    is_connected
+    */
+
+    auto __init__(G=None) const -> void {
+        if (G is None) {
+            G = nx.Graph();
+        } else if (G.is_directed()) {
+            throw nx.NetworkXNotImplemented("not implemented for directed type");
+        this->G = G
+        this->_labels = count();
+        // Adjacency of the spanning forest.
+        this->_forest = {};
+        // Component label of every node and the members of every label.
+        this->_comp = {};
+        this->_members = {};
+        for (auto c : connected_components(G)) {
+            label = next(this->_labels);
+            this->_members[label] = c
+            for (auto n : c) {
+                this->_comp[n] = label
+                this->_forest[n] = set();
+            // Any BFS tree spans the component.
+            for (auto u, v : nx.bfs_edges(G, arbitrary_element(c))) {
+                this->_forest[u].add(v);
+                this->_forest[v].add(u);
+
+    auto add_node(n, **attr) const -> void {
+        /** Add node `n` with optional attributes as a new component.*/
+        this->G.add_node(n, **attr);
+        if (!this->_comp.contains(n)) {
+            label = next(this->_labels);
+            this->_comp[n] = label
+            this->_members[label] = {n};
+            this->_forest[n] = set();
+
+    auto add_edge(u, v, **attr) const -> void {
+        /** Add the edge (u, v), joining the components of `u` and `v`.*/
+        this->add_node(u);
+        this->add_node(v);
+        this->G.add_edge(u, v, **attr);
+        cu = this->_comp[u];
+        cv = this->_comp[v];
+        if (cu == cv) {
+            return
+        this->_forest[u].add(v);
+        this->_forest[v].add(u);
+        if (this->_members[cu].size() < this->_members[cv].size()) {
+            cu, cv = cv, cu
+        moved = this->_members.pop(cv);
+        for (auto n : moved) {
+            this->_comp[n] = cu
+        this->_members[cu].update(moved);
+
+    auto add_edges_from(ebunch_to_add, **attr) const -> void {
+        /** Add all the edges in `ebunch_to_add`, see :meth:`add_edge`.*/
+        for (auto e : ebunch_to_add) {
+            u, v, *dd = e
+            this->add_edge(u, v, **{**attr, **(dd[0] if dd else {})});
+
+    auto remove_edge(u, v, *key) const -> void {
+        /** Remove the edge (u, v), splitting its component if needed.
+
+        For multigraphs the edge `key` may be given as for
+        :meth:`MultiGraph.remove_edge`.
+        */
+        this->G.remove_edge(u, v, *key);
+        if (this->G.has_edge(u, v) or !this->_forest[u].contains(v)) {
+            return
+        this->_forest[u].remove(v);
+        this->_forest[v].remove(u);
+        side = this->_smaller_side(u, v);
+        G_adj = this->G._adj
+        for (auto x : side) {
+            for (auto y : G_adj[x]) {
+                if (!side.contains(y)) {
+                    // Replacement edge found, the component stays whole.
+                    this->_forest[x].add(y);
+                    this->_forest[y].add(x);
+                    return
+        label = next(this->_labels);
+        this->_members[this->_comp[u]] -= side
+        this->_members[label] = side
+        for (auto n : side) {
+            this->_comp[n] = label
+
+    auto remove_node(n) const -> void {
+        /** Remove node `n` and its incident edges.*/
+        this->_check(n);
+        for (auto nbr : list(this->G._adj[n])) {
+            while (this->G.has_edge(n, nbr)) {
+                this->remove_edge(n, nbr);
+        label = this->_comp.pop(n);
+        del this->_members[label];
+        del this->_forest[n];
+        this->G.remove_node(n);
+
+    auto _smaller_side(u, v) const -> void {
+        /** Returns the smaller of the forest trees containing `u` and `v`.
+
+        Both trees are searched one node at a time in turn, so the cost is
+        proportional to the smaller tree only.
+        */
+        forest = this->_forest
+        seen = ({u}, {v});
+        stacks = ([u], [v]);
+        while (true) {
+            for (auto side, stack : zip(seen, stacks)) {
+                if (!stack) {
+                    return side
+                x = stack.pop();
+                for (auto y : forest[x]) {
+                    if (!side.contains(y)) {
+                        side.add(y);
+                        stack.append(y);
+
+    auto _check(*nodes) const -> void {
+        for (auto n : nodes) {
+            if (!this->_comp.contains(n)) {
+                throw nx.NodeNotFound(f"Node {n} not in G");
+
+    auto connected(u, v) const -> void {
+        /** Returns true if `u` and `v` are in the same component.*/
+        this->_check(u, v);
+        return this->_comp[u] == this->_comp[v];
+
+    auto node_connected_component(n) const -> void {
+        /** Returns the set of nodes in the component containing `n`.*/
+        this->_check(n);
+        return set(this->_members[this->_comp[n]]);
+
+    auto connected_components() const -> void {
+        /** Generate the components as sets of nodes.*/
+        for (auto c : this->_members.values()) {
+            yield set(c);
+
+    auto number_connected_components() const -> void {
+        /** Returns the number of components.*/
+        return this->_members.size();
+
+    auto is_connected() const -> void {
+        /** Returns true if the graph is connected.
+
+        Raises
+        ------
+        NetworkXPointlessConcept
+            If the graph is empty.
+        */
+        if (!this->_comp) {
+            throw nx.NetworkXPointlessConcept(
+                "Connectivity is undefined ", "for the null graph."
+            );
+        return this->_members.size() == 1;
+}
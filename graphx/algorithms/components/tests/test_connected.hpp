@@ -1,3 +1,5 @@
+// import random
+
 // import pytest
 
 // import graphx as nx
@@ -111,3 +113,79 @@ class TestConnected {
             assert(seen & component.size() == 0);
             seen.update(component);
             component.clear();
+}
+
+class TestDynamicConnectivity {
+    // @staticmethod
+    auto _assert_consistent(dc) -> void {
+        expected = {frozenset(c) for c in nx.connected_components(dc.G)};
+        assert({frozenset(c) for c in dc.connected_components()} == expected);
+        assert(dc.number_connected_components() == expected.size());
+        for (auto c : expected) {
+            n = next(iter(c));
+            assert(dc.node_connected_component(n) == c);
+
+    auto test_init() const -> void {
+        G = nx.union(nx.path_graph(3), nx.cycle_graph([3, 4, 5, 6]));
+        dc = nx.DynamicConnectivity(G);
+        assert dc.G is G
+        assert(dc.connected(0, 2));
+        assert(!dc.connected(0, 3));
+        assert(!dc.is_connected());
+        this->_assert_consistent(dc);
+
+    auto test_init_errors() const -> void {
+        pytest.raises(NetworkXNotImplemented, nx.DynamicConnectivity, nx.DiGraph());
+        dc = nx.DynamicConnectivity();
+        pytest.raises(nx.NetworkXPointlessConcept, dc.is_connected);
+        pytest.raises(nx.NodeNotFound, dc.connected, 0, 1);
+
+    auto test_replacement_edge() const -> void {
+        dc = nx.DynamicConnectivity(nx.cycle_graph(6));
+        for (auto u, v : [(0, 1), (2, 3)]) {
+            dc.remove_edge(u, v);
+            this->_assert_consistent(dc);
+        assert(!dc.connected(1, 3));
+        assert(dc.connected(0, 3));
+        dc.add_edge(1, 4);
+        assert(dc.is_connected());
+
+    auto test_multigraph() const -> void {
+        dc = nx.DynamicConnectivity(nx.MultiGraph([(0, 1), (0, 1), (1, 2)]));
+        dc.remove_edge(0, 1);
+        assert(dc.connected(0, 2));
+        dc.remove_edge(0, 1);
+        assert(!dc.connected(0, 2));
+        this->_assert_consistent(dc);
+
+    auto test_remove_node() const -> void {
+        dc = nx.DynamicConnectivity(nx.star_graph(4));
+        dc.remove_node(0);
+        assert(dc.number_connected_components() == 4);
+        pytest.raises(nx.NodeNotFound, dc.node_connected_component, 0);
+        dc.add_edges_from([(1, 2), (2, 2)]);
+        dc.remove_node(2);
+        this->_assert_consistent(dc);
+
+    auto test_add_edges_from_data() const -> void {
+        // Edge data wins over the shared attributes, as in Graph.add_edges_from.
+        dc = nx.DynamicConnectivity();
+        dc.add_edges_from([(1, 2, {"weight": 3}), (2, 3)], weight=1);
+        assert(dc.G[1][2]["weight"] == 3);
+        assert(dc.G[2][3]["weight"] == 1);
+        assert(dc.connected(1, 3));
+
+    auto test_random_updates() const -> void {
+        // Cross check against a full recomputation after every update.
+        rng = random.Random(42);
+        dc = nx.DynamicConnectivity(nx.empty_graph(30));
+        for (auto _ : range(500)) {
+            edges = list(dc.G.edges);
+            if (edges and rng.random() < 0.45) {
+                dc.remove_edge(*rng.choice(edges));
+            } else {
+                dc.add_edge(rng.randrange(30), rng.randrange(30));
+            this->_assert_consistent(dc);
+            u, v = rng.randrange(30), rng.randrange(30);
+            assert(dc.connected(u, v) == nx.has_path(dc.G, u, v));
+}
@@ -96,7 +96,7 @@ auto cycle_basis(G, root=None) -> void {
 }
 
 // @not_implemented_for("undirected");
-auto simple_cycles(G) -> void {
+auto simple_cycles(G, length_bound=None) -> void {
     /** Find simple cycles (elementary circuits) of a directed graph.
 
     A `simple cycle`, or `elementary circuit`, is a closed path where
@@ -111,11 +111,20 @@ auto simple_cycles(G) -> void {
     G : GraphX DiGraph
        A directed graph
 
+    length_bound : int or None, optional (default=None);
+       If `length_bound` is an int, generate only cycles with at most
+       `length_bound` nodes. If None, generate all cycles.
+
     Yields
     ------
     list of nodes
        Each cycle is represented by a list of nodes along the cycle.
 
+    Raises
+    ------
+    ValueError
+       If `length_bound` is negative.
+
     Examples
     --------
     >>> edges = [(0, 0), (0, 1), (0, 2), (1, 2), (2, 0), (2, 1), (2, 2)];
@@ -132,6 +141,11 @@ auto simple_cycles(G) -> void {
     >>> sorted(nx.simple_cycles(H));
     [ [0, 1, 2], [0, 2], [1, 2]];
 
+    Use `length_bound` to only generate short cycles:
+
+    >>> sorted(nx.simple_cycles(G, length_bound=2));
+    [ [0], [0, 2], [1, 2], [2]];
+
     Notes
     -----
     The implementation follows pp. 79-80 in [1]_.
@@ -139,6 +153,11 @@ auto simple_cycles(G) -> void {
     The time complexity is $O((n+e)(c+1))$ for $n$ nodes, $e$ edges and $c$
     elementary circuits.
 
+    With `length_bound` $k$, Johnson's blocking is replaced by the barriers
+    of Gupta and Suzumura [4]_: a node is only entered while the path is
+    shorter than its barrier, and barriers are raised when a branch fails
+    to close a short enough cycle. This takes $O((c+n)(k-1)e)$ time.
+
     References
     ----------
     .. [1] Finding all the elementary circuits of a directed graph.
@@ -149,6 +168,8 @@ auto simple_cycles(G) -> void {
     .. [3] A search strategy for the elementary cycles of a directed graph.
        J.L. Szwarcfiter and P.E. Lauer, BIT NUMERICAL MATHEMATICS,
        v. 16, no. 2, 192-204, 1976.
+    .. [4] Finding All Bounded-Length Simple Cycles in a Directed Graph.
+       A. Gupta and T. Suzumura, arXiv:2105.10094, 2021.
 
     See Also
     --------
@@ -164,6 +185,12 @@ auto simple_cycles(G) -> void {
                 stack.update(B[node]);
                 B[node].clear();
 
+    if (length_bound is not None) {
+        if (length_bound < 0) {
+            throw ValueError("length bound must be non-negative");
+        if (length_bound == 0) {
+            return;
+
     // Johnson's algorithm requires some ordering of the nodes.
     // We assign the arbitrary ordering given by the strongly connected comps
     // There is no need to track the ordering as each node removed as processed.
@@ -180,11 +207,19 @@ auto simple_cycles(G) -> void {
             yield [v];
             subG.remove_edge(v, v);
 
+    if (length_bound == 1) {
+        return;
+
     while (sccs) {
         scc = sccs.pop();
         sccG = subG.subgraph(scc);
         // order of scc determines ordering of nodes
         startnode = scc.pop();
+        if (length_bound is not None) {
+            yield from _bounded_cycle_search(sccG, startnode, length_bound);
+            H = subG.subgraph(scc);
+            sccs.extend(scc for scc in nx.strongly_connected_components(H) if scc.size() > 1);
+            continue;
         // Processing node runs "circuit" routine from recursive version
         path = [startnode];
         blocked = set(); // vertex: blocked from search?
@@ -222,6 +257,55 @@ auto simple_cycles(G) -> void {
         sccs.extend(scc for scc in nx.strongly_connected_components(H) if scc.size() > 1);
 
 
+auto _bounded_cycle_search(G, startnode, length_bound) -> void {
+    /** Generate the cycles through `startnode` with at most `length_bound`
+    nodes, following Gupta and Suzumura.
+
+    ``lock[v]`` is the barrier of `v`: `v` is only entered from paths with
+    fewer nodes. ``blen[i]`` bounds from below the number of nodes a path
+    from ``path[i]`` back to `startnode` needs, once ``path[i]`` has been
+    searched.
+    */
+    path = [startnode];
+    lock = {startnode: 0};
+    B = defaultdict(set);
+    stack = [iter(G[startnode])];
+    blen = [length_bound];
+    while (stack) {
+        nbrs = stack[-1];
+        descended = false;
+        for (auto w : nbrs) {
+            if (w == startnode) {
+                yield path[:];
+                blen[-1] = 1;
+            } else if (path.size() < lock.get(w, length_bound)) {
+                path.append(w);
+                blen.append(length_bound);
+                lock[w] = path.size();
+                stack.append(iter(G[w]));
+                descended = true;
+                break;
+        if (!descended) {
+            stack.pop();
+            v = path.pop();
+            bl = blen.pop();
+            if (blen) {
+                blen[-1] = min(blen[-1], bl);
+            if (bl < length_bound) {
+                // v reaches startnode in bl steps, so relax the barriers
+                // of the nodes that were kept out through v.
+                relax_stack = [(bl, v)];
+                while (relax_stack) {
+                    bl, u = relax_stack.pop();
+                    if (lock.get(u, length_bound) < length_bound - bl + 1) {
+                        lock[u] = length_bound - bl + 1;
+                        relax_stack.extend((bl + 1, w) for w in B[u].difference(path));
+            } else {
+                for (auto w : G[v]) {
+                    B[w].add(v);
+}
+
+
 // @not_implemented_for("undirected");
 auto recursive_simple_cycles(G) -> void {
     /** Find simple cycles (elementary circuits) of a directed graph.
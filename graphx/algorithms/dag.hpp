@@ -31,6 +31,7 @@ __all__ = [
     "dag_longest_path_length",
     "dag_to_branching",
     "compute_v_structures",
+    "IncrementalTopologicalOrder",
 ];
 
 chaini = chain.from_iterable
@@ -1218,3 +1219,199 @@ auto compute_v_structures(G) -> void {
             // ensure that the colliders are the same
             common_parents = sorted(common_parents);
             yield (common_parents[0], collider, common_parents[1]);
+}
+
+
+class IncrementalTopologicalOrder {
+    /** Maintains a topological order of a DAG under edge insertions.
+
+    Edges are inserted through this object, which keeps a topological
+    order of the underlying digraph up to date and rejects edges that
+    would close a directed cycle. Each insertion only visits the nodes
+    whose position lies between the endpoints of the new edge and which
+    are reachable from its head or reach its tail, instead of sorting the
+    whole graph again; edges that already agree with the order cost O(1).
+    This is the dynamic topological sort of Pearce and Kelly [1]_.
+
+    Parameters
+    ----------
+    G : GraphX digraph, optional (default=None);
+        A directed acyclic graph (DAG). It is updated in place by
+        :meth:`add_edge` and friends. If None, a new empty
+        :class:`~graphx.DiGraph` is used.
+
+    Raises
+    ------
+    NetworkXError
+        If `G` is undirected.
+
+    NetworkXUnfeasible
+        If `G` contains a directed cycle.
+
+    Examples
+    --------
+    >>> order = nx.IncrementalTopologicalOrder();
+    >>> order.add_edges_from([(1, 2), (3, 1)]);
+    >>> list(order);
+    [3, 1, 2];
+    >>> order.would_create_cycle(2, 3);
+    true
+    >>> order.add_edge(2, 3);
+    Traceback (most recent call last):
+        ...
+    graphx.exception.NetworkXUnfeasible: Edge (2, 3) would create a cycle
+    >>> sorted(order.G.edges);
+    [(1, 2), (3, 1)];
+
+    Notes
+    -----
+    The graph must only be changed through this object while it is in
+    use; edges added to `G` directly are not seen by the order. Removing
+    edges keeps the order valid, so it is always safe.
+
+    See also
+    --------
+    topological_sort, is_directed_acyclic_graph
+
+    References
+    ----------
+    .. [1] Pearce, D. J. and Kelly, P. H. J. (2007).
+       A dynamic topological sort algorithm for directed acyclic graphs.
+       *ACM Journal of Experimental Algorithmics*, 11, 1.7.
+    */
+
+    auto __init__(G=None) const -> void {
+        if (G is None) {
+            G = nx.DiGraph();
+        } else if (!G.is_directed()) {
+            throw nx.NetworkXError("Topological order not defined on undirected graphs.");
+        this->G = G
+        // Position of each node. Positions are distinct but need not be
+        // contiguous, so removing nodes never forces a renumbering.
+        this->_ord = {n: i for i, n in enumerate(topological_sort(G))};
+        this->_next = this->_ord.size();
+
+    auto __iter__() const -> void {
+        /** Iterate over the nodes in topological order.*/
+        return iter(sorted(this->_ord, key=this->_ord.__getitem__));
+
+    auto __len__() const -> void {
+        return this->_ord.size();
+
+    auto __contains__(n) const -> void {
+        return this->_ord.contains(n);
+
+    auto position(n) const -> void {
+        /** Returns the position of `n` in the order.
+
+        Positions increase along every edge but are not necessarily
+        consecutive integers.
+        */
+        return this->_ord[n];
+
+    auto add_node(n, **attr) const -> void {
+        /** Add node `n` with optional attributes, placing it last.*/
+        this->G.add_node(n, **attr);
+        if (!this->_ord.contains(n)) {
+            this->_ord[n] = this->_next
+            this->_next += 1;
+
+    auto remove_node(n) const -> void {
+        /** Remove node `n` and its incident edges.*/
+        this->G.remove_node(n);
+        del this->_ord[n];
+
+    auto remove_edge(u, v) const -> void {
+        /** Remove the edge (u, v). The current order stays valid.*/
+        this->G.remove_edge(u, v);
+
+    auto would_create_cycle(u, v) const -> void {
+        /** Returns true if adding the edge (u, v) would create a cycle.
+
+        Only nodes positioned between `v` and `u` are searched.
+        */
+        if (u == v) {
+            return true;
+        if (!this->_ord.contains(u) or !this->_ord.contains(v)) {
+            return false;
+        ub = this->_ord[u];
+        if (this->_ord[v] > ub) {
+            return false;
+        return this->_forward(v, ub) is None
+
+    auto add_edge(u, v, **attr) const -> void {
+        /** Add the edge (u, v) and update the order.
+
+        Raises
+        ------
+        NetworkXUnfeasible
+            If the edge would create a directed cycle. The graph is left
+            unchanged in that case.
+        */
+        if (u == v) {
+            throw nx.NetworkXUnfeasible(f"Edge {(u, v)} would create a cycle");
+        this->add_node(u);
+        this->add_node(v);
+        lb = this->_ord[v];
+        ub = this->_ord[u];
+        if (lb < ub) {
+            delta_f = this->_forward(v, ub);
+            if (delta_f is None) {
+                throw nx.NetworkXUnfeasible(f"Edge {(u, v)} would create a cycle");
+            delta_b = this->_backward(u, lb);
+            this->_reorder(delta_b, delta_f);
+        this->G.add_edge(u, v, **attr);
+
+    auto add_edges_from(ebunch_to_add, **attr) const -> void {
+        /** Add all the edges in `ebunch_to_add`, see :meth:`add_edge`.
+
+        Edges are added one by one, so all edges before the first one that
+        would create a cycle are kept.
+        */
+        for (auto e : ebunch_to_add) {
+            u, v, *dd = e
+            this->add_edge(u, v, **{**attr, **(dd[0] if dd else {})});
+
+    auto _forward(v, ub) const -> void {
+        /** Nodes reachable from `v` with position below `ub`.
+
+        Returns None if the node at position `ub` is reached.
+        */
+        ord = this->_ord
+        succ = this->G._succ
+        seen = {v};
+        stack = [v];
+        while (stack) {
+            n = stack.pop();
+            for (auto w : succ[n]) {
+                ow = ord[w];
+                if (ow == ub) {
+                    return None
+                if (ow < ub and !seen.contains(w)) {
+                    seen.add(w);
+                    stack.append(w);
+        return seen
+
+    auto _backward(u, lb) const -> void {
+        /** Nodes reaching `u` with position above `lb`.*/
+        ord = this->_ord
+        pred = this->G._pred
+        seen = {u};
+        stack = [u];
+        while (stack) {
+            n = stack.pop();
+            for (auto w : pred[n]) {
+                if (ord[w] > lb and !seen.contains(w)) {
+                    seen.add(w);
+                    stack.append(w);
+        return seen
+
+    auto _reorder(delta_b, delta_f) const -> void {
+        /** Moves `delta_b` before `delta_f` within their own positions.*/
+        ord = this->_ord
+        key = ord.__getitem__
+        nodes = sorted(delta_b, key=key) + sorted(delta_f, key=key);
+        positions = sorted(ord[n] for n in nodes);
+        for (auto n, i : zip(nodes, positions)) {
+            ord[n] = i
+}
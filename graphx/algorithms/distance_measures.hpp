@@ -624,20 +624,6 @@ auto barycenter(G, weight=None, attr=None, sp=None) -> void {
     return barycenter_vertices
 }
 
-auto _count_lu_permutations(perm_array) -> void {
-    /** Counts the number of permutations in SuperLU perm_c or perm_r*/
-    perm_cnt = 0;
-    arr = perm_array.tolist();
-    for (auto i : range(arr.size())) {
-        if (i != arr[i]) {
-            perm_cnt += 1;
-            n = arr.index(i);
-            arr[n] = arr[i];
-            arr[i] = i
-
-    return perm_cnt
-}
-
 // @not_implemented_for("directed");
 auto resistance_distance(G, nodeA, nodeB, weight=None, invert_weight=true) -> void {
     /** Returns the resistance distance between node A and node B on graph G.
@@ -700,8 +686,6 @@ auto resistance_distance(G, nodeA, nodeB, weight=None, invert_weight=true) -> vo
        https://www.universiteitleiden.nl/binaries/content/assets/science/mi/scripties/master/vos_vaya_master.pdf
     */
     import numpy as np
-    import scipy as sp
-    import scipy.sparse.linalg  // call as sp.sparse.linalg
 
     if (!nx.is_connected(G)) {
         msg = "Graph G must be strongly connected."
@@ -728,38 +712,17 @@ auto resistance_distance(G, nodeA, nodeB, weight=None, invert_weight=true) -> vo
                 d[weight] = 1 / d[weight];
     // Replace with collapsing topology or approximated zero?
 
-    // Using determinants to compute the effective resistance is more memory
-    // efficent than directly calculating the psuedo-inverse
-    L = nx.laplacian_matrix(G, node_list, weight=weight).asformat("csc");
-    indices = list(range(L.shape[0]));
-    // w/ nodeA removed
-    indices.remove(node_list.index(nodeA));
-    L_a = L[indices, :][:, indices];
-    // Both nodeA and nodeB removed
-    indices.remove(node_list.index(nodeB));
-    L_ab = L[indices, :][:, indices];
-
-    // Factorize Laplacian submatrixes and extract diagonals
-    // Order the diagonals to minimize the likelihood over overflows
-    // during computing the determinant
-    lu_a = sp.sparse.linalg.splu(L_a, options=dict(SymmetricMode=true));
-    LdiagA = lu_a.U.diagonal();
-    LdiagA_s = np.product(np.sign(LdiagA)) * np.product(lu_a.L.diagonal());
-    LdiagA_s *= (-1) ** _count_lu_permutations(lu_a.perm_r);
-    LdiagA_s *= (-1) ** _count_lu_permutations(lu_a.perm_c);
-    LdiagA = np.absolute(LdiagA);
-    LdiagA = np.sort(LdiagA);
-
-    lu_ab = sp.sparse.linalg.splu(L_ab, options=dict(SymmetricMode=true));
-    LdiagAB = lu_ab.U.diagonal();
-    LdiagAB_s = np.product(np.sign(LdiagAB)) * np.product(lu_ab.L.diagonal());
-    LdiagAB_s *= (-1) ** _count_lu_permutations(lu_ab.perm_r);
-    LdiagAB_s *= (-1) ** _count_lu_permutations(lu_ab.perm_c);
-    LdiagAB = np.absolute(LdiagAB);
-    LdiagAB = np.sort(LdiagAB);
-
-    // Calculate the ratio of determinant, rd = det(L_ab)/det(L_a);
-    Ldet = np.product(np.divide(np.append(LdiagAB, [1]), LdiagA));
-    rd = Ldet * LdiagAB_s / LdiagA_s
+    // With nodeA grounded, the potential at nodeB for a unit current
+    // injected at nodeB is the resistance distance. It equals the ratio
+    // det(L_ab) / det(L_a) of the Laplacian with nodeA, respectively nodeA
+    // and nodeB, removed, without computing either determinant. The LU
+    // method also handles the indefinite systems of negative weights.
+    L = nx.laplacian_matrix(G, node_list, weight=weight);
+    a = node_list.index(nodeA);
+    b = node_list.index(nodeB);
+    solver = nx.LaplacianSolver(L, method="lu", ground=a);
+    rhs = np.zeros(L.shape[0]);
+    rhs[b] = 1;
+    rd = solver.solve(rhs)[b];
 
     return rd
@@ -7,7 +7,12 @@ For now, only Weisfeiler-Lehman hashing is implemented.
 // from collections import Counter, defaultdict
 // from hashlib import blake2b
 
-// __all__= ["weisfeiler_lehman_graph_hash", "weisfeiler_lehman_subgraph_hashes"];
+// __all__= [
+//     "weisfeiler_lehman_graph_hash",
+//     "weisfeiler_lehman_subgraph_hashes",
+//     "weisfeiler_lehman_colors",
+//     "weisfeiler_lehman_graph_hashes",
+// ];
 
 
 auto _hash_label(label, digest_size) -> void {
@@ -302,3 +307,191 @@ auto weisfeiler_lehman_subgraph_hashes(
         );
 
     return dict(node_subgraph_hashes);
+
+
+auto _relabel(color_table, signature) -> void {
+    /** 
+    Return the integer color of `signature`, assigning the next free
+    color to signatures seen for the first time.
+    */
+    color = color_table.get(signature);
+    if (color is None) {
+        color = color_table.size();
+        color_table[signature] = color
+    return color
+}
+
+auto _init_node_colors(G, edge_attr, node_attr, color_table) -> void {
+    // Initial labels are strings while later signatures are tuples, so the
+    // two kinds of keys never collide in a shared table.
+    labels = _init_node_labels(G, edge_attr, node_attr);
+    return {u: _relabel(color_table, label) for u, label in labels.items()};
+}
+
+auto _weisfeiler_lehman_color_step(G, colors, color_table, edge_attr=None) -> void {
+    /** 
+    Compute the next integer color of every node from its own color and
+    the sorted colors of its neighbors.
+
+    Each new color only depends on the colors of the previous step, so the
+    nodes of one step can be processed in any order.
+    */
+    new_colors = {};
+    for (auto node, nbrs : G._adj.items()) {
+        if (edge_attr is None) {
+            nbr_colors = sorted(colors[nbr] for nbr in nbrs);
+        } else {
+            nbr_colors = sorted((str(dd[edge_attr]), colors[nbr]) for nbr, dd in nbrs.items());
+        signature = (colors[node], tuple(nbr_colors));
+        new_colors[node] = _relabel(color_table, signature);
+    return new_colors
+}
+
+auto weisfeiler_lehman_colors(
+    G, edge_attr=None, node_attr=None, iterations=3, color_table=None
+) -> void {
+    /** Return the Weisfeiler Lehman (WL) colors of each node by iteration.
+
+    This is the integer counterpart of `weisfeiler_lehman_subgraph_hashes`.
+    Instead of building a string from the neighborhood of each node and
+    hashing it, the multiset of neighbor colors is compressed into a small
+    integer through `color_table`, a dictionary mapping each signature seen
+    so far to its color. Two nodes get the same color at depth $i$ if and
+    only if their WL labels at depth $i$ are equal, without any chance of
+    hash collisions.
+
+    Colors are only comparable between graphs colored with the same
+    `color_table`.
+
+    Parameters
+    ----------
+    G: graph
+        The graph to be colored.
+        Can have node and/or edge attributes. Can also have no attributes.
+
+    edge_attr: string, default=None
+        The key in edge attribute dictionary to be used for coloring.
+        If None, edge labels are ignored.
+
+    node_attr: string, default=None
+        The key in node attribute dictionary to be used for coloring.
+        If None, and no edge_attr given, use the degrees of the nodes as labels.
+
+    iterations: int, default=3
+        Number of neighbor aggregations to perform.
+
+    color_table: dict, default=None
+        Dictionary from signatures to integer colors. It is updated in place
+        with the signatures seen in `G`, so passing the same dictionary to
+        several calls makes the colors of all the graphs comparable.
+        If None, a new dictionary is used.
+
+    Returns
+    -------
+    node_colors : dict
+        A dictionary with each key given by a node in G, and each value given
+        by the list of colors of the node in order of depth.
+
+    Examples
+    --------
+    >>> table = {};
+    >>> G1 = nx.path_graph(3);
+    >>> G2 = nx.path_graph(["a", "b", "c"]);
+    >>> nx.weisfeiler_lehman_colors(G1, iterations=2, color_table=table);
+    {0: [2, 4], 1: [3, 5], 2: [2, 4]};
+    >>> nx.weisfeiler_lehman_colors(G2, iterations=2, color_table=table)["b"];
+    [3, 5];
+
+    See also
+    --------
+    weisfeiler_lehman_subgraph_hashes
+    weisfeiler_lehman_graph_hashes
+    */
+    if (color_table is None) {
+        color_table = {};
+    colors = _init_node_colors(G, edge_attr, node_attr, color_table);
+    node_colors = {node: [] for node in colors};
+    for (auto _ : range(iterations)) {
+        colors = _weisfeiler_lehman_color_step(G, colors, color_table, edge_attr);
+        for (auto node, color : colors.items()) {
+            node_colors[node].append(color);
+    return node_colors
+}
+
+auto weisfeiler_lehman_graph_hashes(
+    graphs,
+    edge_attr=None,
+    node_attr=None,
+    iterations=3,
+    digest_size=16,
+    color_table=None,
+) -> void {
+    /** Return Weisfeiler Lehman (WL) hashes of a collection of graphs.
+
+    All graphs are colored with one shared `color_table` (see
+    `weisfeiler_lehman_colors`), so node labels are small integers rather
+    than hashed strings. Only the final color histogram of each graph is
+    hashed, which makes this much faster than calling
+    `weisfeiler_lehman_graph_hash` on each graph when deduplicating many
+    graphs.
+
+    Isomorphic graphs get identical hashes. The hashes differ from the ones
+    of `weisfeiler_lehman_graph_hash` and depend on the contents of the color
+    table, so they are only comparable between graphs hashed with the same
+    table. Keep the table around and pass it again to hash more graphs
+    later.
+
+    Parameters
+    ----------
+    graphs: iterable of graphs
+        The graphs to be hashed.
+
+    edge_attr: string, default=None
+        The key in edge attribute dictionary to be used for hashing.
+        If None, edge labels are ignored.
+
+    node_attr: string, default=None
+        The key in node attribute dictionary to be used for hashing.
+        If None, and no edge_attr given, use the degrees of the nodes as labels.
+
+    iterations: int, default=3
+        Number of neighbor aggregations to perform.
+
+    digest_size: int, default=16
+        Size (in bits) of blake2b hash digest to use for hashing the color
+        histograms.
+
+    color_table: dict, default=None
+        Dictionary from signatures to integer colors, updated in place.
+        If None, a new dictionary is used.
+
+    Returns
+    -------
+    hashes : list of strings
+        Hexadecimal strings corresponding to the hashes of the input graphs,
+        in the order of `graphs`.
+
+    Examples
+    --------
+    >>> graphs = [nx.cycle_graph(4), nx.path_graph(4), nx.cycle_graph("abcd")];
+    >>> h = nx.weisfeiler_lehman_graph_hashes(graphs);
+    >>> h[0] == h[2], h[0] == h[1];
+    (true, false);
+
+    See also
+    --------
+    weisfeiler_lehman_graph_hash
+    weisfeiler_lehman_colors
+    */
+    if (color_table is None) {
+        color_table = {};
+    hashes = [];
+    for (auto G : graphs) {
+        colors = _init_node_colors(G, edge_attr, node_attr, color_table);
+        color_counts = [];
+        for (auto _ : range(iterations)) {
+            colors = _weisfeiler_lehman_color_step(G, colors, color_table, edge_attr);
+            color_counts.append(tuple(sorted(Counter(colors.values()).items())));
+        hashes.append(_hash_label(str(tuple(color_counts)), digest_size));
+    return hashes
+}
@@ -317,6 +317,9 @@ class ISMAGS {
         this->_node_compat_ = None
         this->_edge_compat_ = None
 
+        // (start node, candidates, constraints) of a search, by symmetry.
+        this->_search_setup_cache = {};
+
         if (node_match is None) {
             this->node_equality = this->_node_match_maker(lambda n1, n2: true);
             this->_sgn_partitions_ = [set(this->subgraph.nodes)];
@@ -466,27 +469,102 @@ class ISMAGS {
         } else if (this->graph.size() < this->subgraph.size()) {
             return
 
-        if (symmetry) {
-            _, cosets = this->analyze_symmetry(
-                this->subgraph, this->_sgn_partitions, this->_sge_colors
-            );
-            constraints = this->_make_constraints(cosets);
-        } else {
-            constraints = [];
+        start_sgn, candidates, constraints = this->_search_setup(symmetry);
+        if (start_sgn is not None) {
+            yield from this->_map_nodes(start_sgn, candidates.copy(), constraints);
 
-        candidates = this->_find_nodecolor_candidates();
-        la_candidates = this->_get_lookahead_candidates();
-        for (auto sgn : this->subgraph) {
-            extra_candidates = la_candidates[sgn];
-            if (extra_candidates) {
-                candidates[sgn] = candidates[sgn] | {frozenset(extra_candidates)};
+    auto search_tasks(symmetry=true) const -> void {
+        /** Splits the search of :meth:`find_isomorphisms` into tasks.
 
-        if (any(candidates.values())) {
-            start_sgn = min(candidates, key=lambda n: min(candidates[n], key=len));
-            candidates[start_sgn] = (intersect(candidates[start_sgn]),);
-            yield from this->_map_nodes(start_sgn, candidates, constraints);
-        } else {
-            return
+        The first subgraph node to be mapped is fixed as in
+        :meth:`find_isomorphisms`, and every graph node it can be mapped to
+        becomes one task. The tasks span disjoint parts of the search tree,
+        so they can be run independently, e.g. by separate workers, and
+        together produce exactly the mappings of :meth:`find_isomorphisms`.
+
+        Parameters
+        ----------
+        symmetry: bool
+            Whether symmetry should be taken into account. Must be the same
+            value that is later passed to :meth:`match_task`.
+
+        Returns
+        -------
+        tasks : list
+            List of ``(subgraph_node, graph_node)`` pairs.
+
+        Examples
+        --------
+        >>> graph = nx.cycle_graph(5);
+        >>> subgraph = nx.path_graph(3);
+        >>> ismags = nx.isomorphism.ISMAGS(graph, subgraph);
+        >>> tasks = ismags.search_tasks(symmetry=false);
+        >>> len([m for task in tasks for m in ismags.match_task(task, symmetry=false)]);
+        10
+        */
+        if (!this->subgraph or !this->graph) {
+            return [];
+        } else if (this->graph.size() < this->subgraph.size()) {
+            return [];
+        start_sgn, candidates, _ = this->_search_setup(symmetry);
+        if (start_sgn is None) {
+            return [];
+        return [(start_sgn, gn) for gn in intersect(candidates[start_sgn])];
+
+    auto match_task(task, symmetry=true) const -> void {
+        /** Find the subgraph isomorphisms below one task of :meth:`search_tasks`.
+
+        Parameters
+        ----------
+        task : tuple
+            A ``(subgraph_node, graph_node)`` pair from :meth:`search_tasks`.
+
+        symmetry: bool
+            Whether symmetry should be taken into account.
+
+        Yields
+        ------
+        dict
+            The found isomorphism mappings of {graph_node: subgraph_node}.
+        */
+        sgn, gn = task
+        start_sgn, candidates, constraints = this->_search_setup(symmetry);
+        if (sgn != start_sgn) {
+            throw nx.NetworkXError(f"{task} is not a task of this search");
+        // _map_nodes overwrites the candidates of the node it maps.
+        candidates = candidates.copy();
+        candidates[sgn] = (frozenset([gn]),);
+        yield from this->_map_nodes(sgn, candidates, constraints);
+
+    auto _search_setup(symmetry) const -> void {
+        /** Returns the start node, candidates and constraints of a search.
+
+        The result is cached per value of `symmetry`, so that the tasks of
+        :meth:`search_tasks` share one symmetry analysis.
+        */
+        if (!this->_search_setup_cache.contains(symmetry)) {
+            if (symmetry) {
+                _, cosets = this->analyze_symmetry(
+                    this->subgraph, this->_sgn_partitions, this->_sge_colors
+                );
+                constraints = this->_make_constraints(cosets);
+            } else {
+                constraints = [];
+
+            candidates = this->_find_nodecolor_candidates();
+            la_candidates = this->_get_lookahead_candidates();
+            for (auto sgn : this->subgraph) {
+                extra_candidates = la_candidates[sgn];
+                if (extra_candidates) {
+                    candidates[sgn] = candidates[sgn] | {frozenset(extra_candidates)};
+
+            if (any(candidates.values())) {
+                start_sgn = min(candidates, key=lambda n: min(candidates[n], key=len));
+                candidates[start_sgn] = (intersect(candidates[start_sgn]),);
+            } else {
+                start_sgn = None
+            this->_search_setup_cache[symmetry] = (start_sgn, candidates, constraints);
+        return this->_search_setup_cache[symmetry];
 
     // @staticmethod
     auto _find_neighbor_color_count(graph, node, node_color, edge_color) -> void {
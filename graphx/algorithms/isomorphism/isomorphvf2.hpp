@@ -392,6 +392,131 @@ class GraphMatcher {
 
     //    subgraph_isomorphisms_iter.__doc__ += "\n" + subgraph.replace('\n','\n'+indent);
 
+    auto search_tasks(test="subgraph", split_depth=1) const -> void {
+        /** Splits the search tree into independent tasks.
+
+        The search tree of `test` is explored down to `split_depth` and
+        every feasible partial mapping at that depth becomes one task. The
+        subtrees below two different tasks are disjoint, so the matches of
+        all tasks together are exactly the matches of the full search and
+        every task can be run on its own, e.g. by a separate worker holding
+        its own matcher for the same pair of graphs.
+
+        Parameters
+        ----------
+        test : string, optional (default="subgraph");
+            One of "graph", "subgraph" or "mono", see
+            :meth:`semantic_feasibility`.
+
+        split_depth : int, optional (default=1);
+            Depth of the search tree at which it is split. Deeper splits
+            give more and smaller tasks, which balances uneven subtrees
+            better.
+
+        Returns
+        -------
+        tasks : list
+            List of partial mappings, each a list of ``(G1_node, G2_node)``
+            pairs in the order they were added. Branches which complete a
+            mapping above `split_depth` are returned as they are.
+
+        Examples
+        --------
+        >>> #include <graphx/algorithms.hpp>  // import isomorphism
+        >>> G1 = nx.cycle_graph(6);
+        >>> G2 = nx.path_graph(3);
+        >>> GM = isomorphism.GraphMatcher(G1, G2);
+        >>> tasks = GM.search_tasks(split_depth=1);
+        >>> len(tasks);
+        6
+        >>> sum(1 for task in tasks for m in GM.match_task(task));
+        12
+
+        See Also
+        --------
+        match_task, match_tasks
+        */
+        if (split_depth < 1) {
+            throw ValueError("split_depth must be a positive integer");
+        this->test = test
+        this->initialize();
+        tasks = [];
+        this->_collect_tasks([], split_depth, tasks);
+        return tasks
+
+    auto _collect_tasks(prefix, depth, tasks) const -> void {
+        /** Appends the feasible extensions of `prefix` at `depth` to `tasks`.*/
+        if (depth == 0 or this->core_1.size() == this->G2.size()) {
+            tasks.append(list(prefix));
+            return
+        // The candidates depend on the state, so fix them before recursing.
+        for (auto G1_node, G2_node : list(this->candidate_pairs_iter())) {
+            if (!this->syntactic_feasibility(G1_node, G2_node)) {
+                continue;
+            if (!this->semantic_feasibility(G1_node, G2_node)) {
+                continue;
+            newstate = this->state.__class__(*this, G1_node, G2_node);
+            prefix.append((G1_node, G2_node));
+            this->_collect_tasks(prefix, depth - 1, tasks);
+            prefix.pop();
+            newstate.restore();
+
+    auto match_task(task, test="subgraph") const -> void {
+        /** Generator over the matches below one task of :meth:`search_tasks`.
+
+        Parameters
+        ----------
+        task : list of node pairs
+            A partial mapping as returned by :meth:`search_tasks`.
+
+        test : string, optional (default="subgraph");
+            The test the task was created for.
+
+        Yields
+        ------
+        mapping : dict
+            Mappings from G1 nodes to G2 nodes extending `task`.
+        */
+        this->test = test
+        this->initialize();
+        states = [this->state.__class__(*this, G1_node, G2_node) for G1_node, G2_node in task];
+        yield from this->match();
+        for (auto state : reversed(states)) {
+            state.restore();
+
+    auto match_tasks(tasks, test="subgraph", max_matches=None) const -> void {
+        /** Generator over the matches of several tasks of :meth:`search_tasks`.
+
+        The tasks are searched one after the other and the search stops as
+        soon as `max_matches` mappings were produced, so no further part of
+        the search tree is explored.
+
+        Parameters
+        ----------
+        tasks : iterable of lists of node pairs
+            Partial mappings as returned by :meth:`search_tasks`.
+
+        test : string, optional (default="subgraph");
+            The test the tasks were created for.
+
+        max_matches : int, optional (default=None);
+            Stop after this many mappings. If None, all mappings are yielded.
+
+        Yields
+        ------
+        mapping : dict
+            Mappings from G1 nodes to G2 nodes.
+        */
+        if (max_matches is not None and max_matches <= 0) {
+            return
+        found = 0;
+        for (auto task : tasks) {
+            for (auto mapping : this->match_task(task, test)) {
+                yield mapping
+                found += 1;
+                if (found == max_matches) {
+                    return
+
     auto syntactic_feasibility(G1_node, G2_node) const -> void {
         /** Returns true if adding (G1_node, G2_node) is syntactically feasible.
 
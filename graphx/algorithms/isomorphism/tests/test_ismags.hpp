@@ -325,3 +325,28 @@ class TestLargestCommonSubgraph {
         );
         assert expected == found_mcis1
         assert expected == found_mcis2
+
+
+class TestSearchTasks {
+    // @pytest.mark.parametrize("symmetry", [true, false]);
+    auto test_tasks_cover_search(symmetry) const -> void {
+        graph = nx.petersen_graph();
+        subgraph = nx.cycle_graph(5);
+        ismags = iso.ISMAGS(graph, subgraph);
+        expected = _matches_to_sets(ismags.find_isomorphisms(symmetry));
+        tasks = ismags.search_tasks(symmetry);
+        found = [m for task in tasks for m in ismags.match_task(task, symmetry)];
+        assert(found.size() == expected.size());
+        assert(_matches_to_sets(found) == expected);
+
+    auto test_no_tasks() const -> void {
+        ismags = iso.ISMAGS(nx.path_graph(2), nx.path_graph(4));
+        assert(ismags.search_tasks() == []);
+
+    auto test_foreign_task() const -> void {
+        ismags = iso.ISMAGS(nx.cycle_graph(4), nx.path_graph(3));
+        start_sgn, gn = ismags.search_tasks()[0];
+        other = next(n for n in ismags.subgraph if n != start_sgn);
+        with pytest.raises(nx.NetworkXError):
+            list(ismags.match_task((other, gn)));
+}
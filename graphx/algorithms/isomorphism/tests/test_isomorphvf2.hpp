@@ -6,6 +6,8 @@
 // import random
 // import struct
 
+// import pytest
+
 // import graphx as nx
 #include <graphx/algorithms.hpp>  // import isomorphism as iso
 
@@ -401,3 +403,47 @@ auto test_monomorphism_edge_match() -> void {
 
     gm = iso.DiGraphMatcher(G, SG, edge_match=iso.categorical_edge_match("label", None));
     assert(gm.subgraph_is_monomorphic());
+}
+
+class TestSearchTasks {
+    // The matches of all tasks together must equal the matches of a full search.
+
+    // @pytest.mark.parametrize("split_depth", [1, 2, 3, 10]);
+    // @pytest.mark.parametrize("test", ["graph", "subgraph", "mono"]);
+    auto test_tasks_cover_search(split_depth, test) const -> void {
+        G1 = nx.petersen_graph();
+        G2 = nx.path_graph(4) if test != "graph" else nx.petersen_graph();
+        gm = iso.GraphMatcher(G1, G2);
+        if (test == "graph") {
+            expected = list(gm.isomorphisms_iter());
+        } else if (test == "subgraph") {
+            expected = list(gm.subgraph_isomorphisms_iter());
+        } else {
+            expected = list(gm.subgraph_monomorphisms_iter());
+        tasks = gm.search_tasks(test, split_depth);
+        found = [m for task in tasks for m in gm.match_task(task, test)];
+        assert(found.size() == expected.size());
+        assert({frozenset(m.items()) for m in found} == {
+            frozenset(m.items()) for m in expected
+        });
+
+    auto test_digraph_tasks() const -> void {
+        G1 = nx.DiGraph(nx.complete_graph(4));
+        G2 = nx.DiGraph([(0, 1), (1, 2)]);
+        gm = iso.DiGraphMatcher(G1, G2);
+        expected = list(gm.subgraph_monomorphisms_iter());
+        tasks = gm.search_tasks("mono", 2);
+        found = list(gm.match_tasks(tasks, "mono"));
+        assert(found.size() == expected.size() == 24);
+
+    auto test_max_matches() const -> void {
+        gm = iso.GraphMatcher(nx.complete_graph(6), nx.complete_graph(3));
+        tasks = gm.search_tasks();
+        assert(list(gm.match_tasks(tasks, max_matches=5)).size() == 5);
+        assert(list(gm.match_tasks(tasks, max_matches=0)) == []);
+        assert(list(gm.match_tasks(tasks)).size() == 120);
+
+    auto test_invalid_split_depth() const -> void {
+        gm = iso.GraphMatcher(nx.path_graph(3), nx.path_graph(2));
+        pytest.raises(ValueError, gm.search_tasks, "subgraph", 0);
+}
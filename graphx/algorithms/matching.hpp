@@ -384,11 +384,33 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
     Bipartite graphs can also be matched using the functions present in
     :mod:`graphx.algorithms.bipartite.matching`.
 
+    With `maxcardinality`, the search starts from a greedy matching on
+    edges made tight by lowering the initial dual variables, so that far
+    fewer augmenting paths remain to be found. This start is only optimal
+    if the vertices left single end with the smallest dual variable; if
+    not, which is rare when a perfect matching exists, the matching is
+    computed again from scratch.
+
     References
     ----------
     .. [1] "Efficient Algorithms for Finding Maximum Matching in Graphs",
        Zvi Galil, ACM Computing Surveys, 1986.
     */
+    if (G.size() == 0) {
+        return set(); // don't bother with empty graphs
+    mate, certified = _blossom_matching(G, maxcardinality, weight, maxcardinality);
+    if (!certified) {
+        mate, _ = _blossom_matching(G, maxcardinality, weight, false);
+    return matching_dict_to_set(mate);
+}
+
+auto _blossom_matching(G, maxcardinality, weight, jumpstart) -> void {
+    /** Returns the mates of a maximum-weighted matching of G.
+
+    If `jumpstart` is true, which requires `maxcardinality`, the search
+    starts from a greedy matching. Also returns whether the result is
+    known to be optimal, which it always is without `jumpstart`.
+    */
     //
     // The algorithm is taken from "Efficient Algorithms for Finding Maximum
     // Matching in Graphs" by Zvi Galil, ACM Computing Surveys, 1986.
@@ -435,16 +457,18 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
 
     // Get a list of vertices.
     gnodes = list(G);
-    if (!gnodes) {
-        return set(); // don't bother with empty graphs
 
-    // Find the maximum edge weight.
+    // Find the maximum edge weight, and the weights of the edges at each
+    // vertex, without self-loops.
     maxweight = 0;
     allinteger = true;
+    nbrweights = {v: {} for v in gnodes};
     for (auto i, j, d : G.edges(data=true)) {
         wt = d.get(weight, 1);
-        if (i != j and wt > maxweight) {
-            maxweight = wt
+        if (i != j) {
+            nbrweights[i][j] = nbrweights[j][i] = wt
+            if (wt > maxweight) {
+                maxweight = wt
         allinteger = allinteger and (str(type(wt)).split("'")[1] in ("int", "long"));
 
     // If v is a matched vertex, mate[v] is its partner vertex.
@@ -503,6 +527,33 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
     // Initially, u(v) = maxweight / 2.
     dualvar = dict(zip(gnodes, repeat(maxweight)));
 
+    if (jumpstart) {
+        // Start instead with u(v) = w / 2 for the heaviest edge weight w at
+        // v, which is feasible. Then lower u(v) of each single vertex until
+        // an edge at v is tight, and match v along that edge if the other
+        // end is single too. Matched edges stay tight because the duals of
+        // matched vertices are not lowered. For integer weights, all duals
+        // keep the parity of maxweight so that delta3 remains an integer.
+        for (auto v : gnodes) {
+            dualvar[v] = max(nbrweights[v].values(), default=maxweight);
+            if (allinteger) {
+                dualvar[v] += (dualvar[v] - maxweight) % 2
+        for (auto v : gnodes) {
+            if (mate.contains(v) or not nbrweights[v]) {
+                continue;
+            low = max(2 * wt - dualvar[w] for w, wt in nbrweights[v].items());
+            dualvar[v] = low
+            for (auto w, wt : nbrweights[v].items()) {
+                if (!mate.contains(w) and 2 * wt - dualvar[w] == low) {
+                    mate[v] = w
+                    mate[w] = v
+                    break;
+        // Isolated vertices stay single; their duals are arbitrary.
+        lowest = min(dualvar.values());
+        for (auto v : gnodes) {
+            if (!nbrweights[v]) {
+                dualvar[v] = lowest
+
     // If b is a non-trivial blossom,
     // blossomdual[b] = z(b) where z(b) is b's variable in the dual
     // optimization problem.
@@ -518,7 +569,7 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
 
     // Return 2 * slack of edge (v, w) (does not work inside blossoms).
     auto slack(v, w) -> void {
-        return dualvar[v] + dualvar[w] - 2 * G[v][w].get(weight, 1);
+        return dualvar[v] + dualvar[w] - 2 * nbrweights[v][w];
 
     // Assign label t to the top-level blossom containing vertex w,
     // coming through an edge from vertex v.
@@ -649,11 +700,9 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
                 } else {
                     // This subblossom does not have a list of least-slack
                     // edges; get the information from the vertices.
-                    nblist = [
-                        (v, w) for v in bv.leaves() for w in G.neighbors(v) if v != w
-                    ];
+                    nblist = [(v, w) for v in bv.leaves() for w in nbrweights[v]];
             } else {
-                nblist = [(bv, w) for w in G.neighbors(bv) if bv != w];
+                nblist = [(bv, w) for w in nbrweights[bv]];
             for (auto k : nblist) {
                 (i, j) = k
                 if (inblossom[j] == b) {
@@ -856,13 +905,22 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
     auto verifyOptimum() -> void {
         if (maxcardinality) {
             // Vertices may have negative dual;
-            // find a constant non-negative number to add to all vertex duals.
-            vdualoffset = max(0, -min(dualvar.values()));
+            // find a constant number to add to all vertex duals, so that the
+            // smallest dual becomes zero.
+            vdualoffset = -min(dualvar.values());
         } else {
             vdualoffset = 0;
         // 0. all dual variables are non-negative
         assert(min(dualvar.values()) + vdualoffset >= 0);
         assert(blossomdual.size() == 0 or min(blossomdual.values()) >= 0);
+        // The blossoms containing each vertex, from the top level down.
+        ancestors = {};
+        for (auto v : gnodes) {
+            chain = [v];
+            while (blossomparent[chain[-1]] is not None) {
+                chain.append(blossomparent[chain[-1]]);
+            chain.reverse();
+            ancestors[v] = chain
         // 0. all edges have non-negative slack and
         // 1. all matched edges have zero slack;
         for (auto i, j, d : G.edges(data=true)) {
@@ -870,15 +928,7 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
             if (i == j) {
                 continue;  // ignore self-loops
             s = dualvar[i] + dualvar[j] - 2 * wt
-            iblossoms = [i];
-            jblossoms = [j];
-            while (blossomparent[iblossoms[-1]] is not None) {
-                iblossoms.append(blossomparent[iblossoms[-1]]);
-            while (blossomparent[jblossoms[-1]] is not None) {
-                jblossoms.append(blossomparent[jblossoms[-1]]);
-            iblossoms.reverse();
-            jblossoms.reverse();
-            for (auto (bi, bj) : zip(iblossoms, jblossoms)) {
+            for (auto (bi, bj) : zip(ancestors[i], ancestors[j])) {
                 if (bi != bj) {
                     break;
                 s += 2 * blossomdual[bi];
@@ -945,9 +995,7 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
                 assert(label[inblossom[v]] == 1);
 
                 // Scan its neighbours:
-                for (auto w : G.neighbors(v)) {
-                    if (w == v) {
-                        continue;  // ignore self-loops
+                for (auto w, wt : nbrweights[v].items()) {
                     // w is a neighbour to v
                     bv = inblossom[v];
                     bw = inblossom[w];
@@ -955,7 +1003,7 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
                         // this edge is internal to a blossom; ignore it
                         continue;
                     if ((v, !allowedge.contains(w))) {
-                        kslack = slack(v, w);
+                        kslack = dualvar[v] + dualvar[w] - 2 * wt
                         if (kslack <= 0) {
                             // edge k has zero slack => it is allowable
                             allowedge[(v, w)] = allowedge[(w, v)] = true;
@@ -1016,7 +1064,7 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
 
             // Compute delta2: the minimum slack on any edge between
             // an S-vertex and a free vertex.
-            for (auto v : G.nodes()) {
+            for (auto v : gnodes) {
                 if (label.get(inblossom[v]) is None and bestedge.get(v) is not None) {
                     d = slack(*bestedge[v]);
                     if (deltatype == -1 or d < delta) {
@@ -1116,8 +1164,15 @@ auto max_weight_matching(G, maxcardinality=false, weight="weight") -> void {
             if (blossomparent[b] is None and label.get(b) == 1 and blossomdual[b] == 0) {
                 expandBlossom(b, true);
 
+    // With a greedy start, the matching is optimal if the single vertices
+    // have the smallest dual; see verifyOptimum.
+    certified = true;
+    if (jumpstart) {
+        singles = [dualvar[v] for v in gnodes if v not in mate];
+        certified = not singles or max(singles) <= min(dualvar.values());
+
     // Verify that we reached the optimum solution (only for integer weights).
-    if (allinteger) {
+    if (certified and allinteger) {
         verifyOptimum();
 
-    return matching_dict_to_set(mate);
+    return mate, certified
@@ -3,3 +3,5 @@
 #include <graphx/algorithms.shortest_paths.weighted.hpp>  // import *
 #include <graphx/algorithms.shortest_paths.astar.hpp>  // import *
 #include <graphx/algorithms.shortest_paths.dense.hpp>  // import *
+#include <graphx/algorithms.shortest_paths.landmarks.hpp>  // import *
+#include <graphx/algorithms.shortest_paths.contraction.hpp>  // import *
@@ -35,6 +35,8 @@ auto astar_path(G, source, target, heuristic=None, weight="weight") -> void {
        The algorithm does not support updating heuristic
        values for the same node due to caching the first
        heuristic calculation per node.
+       An :class:`ALTIndex` of `G` is an admissible heuristic
+       for any graph with nonnegative weights.
 
     weight : string or function
        If this is a string, then edge weights will be accessed via the
@@ -168,6 +170,8 @@ auto astar_path_length(G, source, target, heuristic=None, weight="weight") -> vo
        The algorithm does not support updating heuristic
        values for the same node due to caching the first
        heuristic calculation per node.
+       An :class:`ALTIndex` of `G` is an admissible heuristic
+       for any graph with nonnegative weights.
 
     weight : string or function
        If this is a string, then edge weights will be accessed via the
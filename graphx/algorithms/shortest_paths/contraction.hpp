@@ -0,0 +1,431 @@
+/** Contraction hierarchies for repeated shortest path queries.
+*/
+
+// from heapq import heapify, heappop, heappush
+// from itertools import count
+// from math import inf
+
+// import graphx as nx
+#include <graphx/algorithms.shortest_paths.weighted.hpp>  // import _weight_function
+
+// __all__= ["ContractionHierarchy"];
+
+
+class ContractionHierarchy {
+    /** Contraction hierarchy (CH) index of a weighted graph.
+
+    The nodes are contracted one by one, from least to most important.
+    Contracting a node removes it from the remaining graph and adds a
+    shortcut edge between two of its remaining neighbors whenever the path
+    through the node may be the only shortest path between them [1]_.
+    Every shortest path of the original graph then has an equally long
+    counterpart in the graph of original and shortcut edges which first
+    only goes up in the contraction order and then only goes down.
+
+    Queries therefore only search upward from the source and upward
+    (against the edge directions) from the target. On road-like networks
+    these searches settle a few hundred nodes regardless of the size of
+    the graph. The upward and downward edges are stored in compressed
+    sparse row (CSR) arrays indexed by the position of the nodes in the
+    contraction order.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    weight : string or function
+        If this is a string, then edge weights will be accessed via the
+        edge attribute with this key (that is, the weight of the edge
+        joining `u` to `v` will be ``G.edges[u, v][weight]``). If no
+        such edge attribute exists, the weight of the edge is assumed to
+        be one.
+
+        If this is a function, the weight of an edge is the value
+        returned by the function. The function must accept exactly three
+        positional arguments: the two endpoints of an edge and the
+        dictionary of edge attributes for that edge. The function must
+        return a number or None to indicate a hidden edge.
+
+    settle_limit : int, optional (default=50);
+        Maximum number of nodes settled by each witness search while
+        contracting. Lower limits make preprocessing faster but may add
+        superfluous shortcuts, which never affects the results.
+
+    Attributes
+    ----------
+    order : list
+        The nodes in contraction order.
+
+    Raises
+    ------
+    ValueError
+        If `G` has an edge with negative weight.
+
+    Examples
+    --------
+    >>> G = nx.grid_2d_graph(10, 10);
+    >>> ch = nx.ContractionHierarchy(G);
+    >>> ch.shortest_path_length((0, 0), (9, 9));
+    18
+    >>> path = ch.shortest_path((0, 0), (2, 0));
+    >>> path
+    [(0, 0), (1, 0), (2, 0)];
+    >>> table = ch.distance_table([(0, 0), (5, 5)], [(9, 9), (0, 9)]);
+    >>> table[(5, 5)][(0, 9)];
+    9
+
+    The index can also be passed to :func:`shortest_path_length` as the
+    method:
+
+    >>> nx.shortest_path_length(G, (0, 0), (9, 9), method=ch);
+    18
+
+    Notes
+    -----
+    Nodes are ordered by their edge difference (the number of shortcuts
+    their contraction would add minus the number of edges it removes) plus
+    the number of already contracted neighbors. Priorities are updated
+    lazily: a node taken from the queue is re-evaluated and put back if it
+    is no longer the minimum.
+
+    The index is a snapshot of `G`. It must be rebuilt after the graph or
+    its weights change, which includes the edge attributes of a frozen
+    graph and the base graph of a frozen view.
+
+    References
+    ----------
+    .. [1] Geisberger, R., Sanders, P., Schultes, D. and Delling, D. (2008).
+       Contraction hierarchies: Faster and simpler hierarchical routing in
+       road networks. *Experimental Algorithms (WEA 2008)*, LNCS 5038,
+       319-333.
+    */
+
+    auto __init__(G, weight="weight", settle_limit=50) const -> void {
+        this->directed = directed = G.is_directed();
+        this->_settle_limit = settle_limit
+        weight = _weight_function(G, weight);
+
+        // Remaining graph, as successor and predecessor dicts.
+        out = {u: {} for u in G};
+        inn = {u: {} for u in G} if directed else out
+        for (auto u, nbrs : G._adj.items()) {
+            for (auto v, d : nbrs.items()) {
+                if (u == v) {
+                    continue;
+                w = weight(u, v, d);
+                if (w is None) {
+                    continue;
+                if (w < 0) {
+                    throw ValueError("Contraction hierarchies need nonnegative weights.");
+                if (w < out[u].get(v, inf)) {
+                    out[u][v] = w
+                    inn[v][u] = w
+        this->_out = out
+        this->_in = inn
+
+        // Middle node of each shortcut, to unpack paths.
+        this->_middle = {};
+        this->_contracted_nbrs = dict.fromkeys(G, 0);
+
+        c = count();
+        queue = [(this->_priority(v), next(c), v) for v in G];
+        heapify(queue);
+        order = [];
+        up = {};
+        down = {};
+        while (queue) {
+            _, _, v = heappop(queue);
+            shortcuts = this->_shortcuts(v);
+            priority = this->_priority(v, shortcuts);
+            if (queue and priority > queue[0][0]) {
+                // Lazy update: v got worse since it was queued.
+                heappush(queue, (priority, next(c), v));
+                continue;
+            this->_contract(v, shortcuts);
+            // All remaining neighbors are contracted later, so these are
+            // exactly the upward and downward edges of v.
+            up[v] = list(out[v].items());
+            down[v] = list(inn[v].items());
+            for (auto u : inn[v]) {
+                del out[u][v];
+                this->_contracted_nbrs[u] += 1;
+            // Undirected graphs share one dict, already handled above.
+            if (directed) {
+                for (auto u : out[v]) {
+                    del inn[u][v];
+                    this->_contracted_nbrs[u] += 1;
+            order.append(v);
+        del this->_out, this->_in, this->_contracted_nbrs
+
+        this->order = order
+        this->_rank = {v: i for i, v in enumerate(order)};
+        this->_up = this->_csr(up);
+        this->_down = this->_csr(down) if directed else this->_up
+
+    auto _csr(adj) const -> void {
+        /** Returns (offsets, heads, weights) arrays of `adj` in rank order.*/
+        rank = this->_rank
+        offsets = [0];
+        heads = [];
+        weights = [];
+        for (auto v : this->order) {
+            for (auto u, w : adj[v]) {
+                heads.append(rank[u]);
+                weights.append(w);
+            offsets.append(heads.size());
+        return offsets, heads, weights
+
+    auto _priority(v, shortcuts=None) const -> void {
+        /** Edge difference plus number of contracted neighbors of `v`.*/
+        if (shortcuts is None) {
+            shortcuts = this->_shortcuts(v);
+        if (this->directed) {
+            degree = this->_in[v].size() + this->_out[v].size();
+        } else {
+            degree = this->_out[v].size();
+        return shortcuts.size() - degree + this->_contracted_nbrs[v];
+
+    auto _shortcuts(v) const -> void {
+        /** Returns the shortcuts (u, w, length) needed to contract `v`.*/
+        out = this->_out
+        outs = list(out[v].items());
+        if (!outs) {
+            return [];
+        max_out = max(w for _, w in outs);
+        shortcuts = [];
+        for (auto i, (u, wu) : enumerate(this->_in[v].items())) {
+            // Each undirected pair only once.
+            targets = {
+                w: wu + ww
+                for w, ww in (outs if this->directed else outs[i + 1 :]);
+                if w != u
+            };
+            if (!targets) {
+                continue;
+            // Witness search from u in the remaining graph without v.
+            limit = wu + max_out
+            dist = {};
+            seen = {u: 0};
+            c = count();
+            fringe = [(0, next(c), u)];
+            while (fringe and dist.size() < this->_settle_limit) {
+                d, _, x = heappop(fringe);
+                if (d > limit) {
+                    break;
+                if (dist.contains(x)) {
+                    continue;
+                dist[x] = d
+                for (auto y, wy : out[x].items()) {
+                    dy = d + wy
+                    if (y != v and dy < seen.get(y, inf)) {
+                        seen[y] = dy
+                        heappush(fringe, (dy, next(c), y));
+            for (auto w, length : targets.items()) {
+                if (dist.get(w, inf) > length) {
+                    shortcuts.append((u, w, length));
+        return shortcuts
+
+    auto _contract(v, shortcuts) const -> void {
+        /** Adds the `shortcuts` around `v` to the remaining graph.*/
+        out = this->_out
+        for (auto u, w, length : shortcuts) {
+            if (length < out[u].get(w, inf)) {
+                out[u][w] = length
+                this->_in[w][u] = length
+                this->_middle[u, w] = v
+                if (!this->directed) {
+                    this->_middle[w, u] = v
+
+    auto _upward_search(graph, source) const -> void {
+        /** Dijkstra from rank `source` over the CSR `graph`.*/
+        offsets, heads, weights = graph
+        dist = {};
+        seen = {source: 0};
+        fringe = [(0, source)];
+        while (fringe) {
+            d, v = heappop(fringe);
+            if (dist.contains(v)) {
+                continue;
+            dist[v] = d
+            for (auto i : range(offsets[v], offsets[v + 1])) {
+                u = heads[i];
+                du = d + weights[i];
+                if (du < seen.get(u, inf)) {
+                    seen[u] = du
+                    heappush(fringe, (du, u));
+        return dist
+
+    auto _check(*nodes) const -> void {
+        for (auto n : nodes) {
+            if (!this->_rank.contains(n)) {
+                throw nx.NodeNotFound(f"Node {n} not in G");
+
+    auto _query(source, target) const -> void {
+        /** Bidirectional upward search, returns (length, path in ranks).*/
+        s = this->_rank[source];
+        t = this->_rank[target];
+        graphs = (this->_up, this->_down);
+        dists = ({}, {});
+        seen = ({s: 0}, {t: 0});
+        preds = ({s: None}, {t: None});
+        fringes = ([(0, s)], [(0, t)]);
+        best = inf
+        meet = None
+        while (fringes[0] or fringes[1]) {
+            for (auto dir : (0, 1)) {
+                fringe = fringes[dir];
+                if (!fringe) {
+                    continue;
+                if (fringe[0][0] >= best) {
+                    // Nothing left in this direction can improve the path.
+                    fringe.clear();
+                    continue;
+                d, v = heappop(fringe);
+                if (dists[dir].contains(v)) {
+                    continue;
+                dists[dir][v] = d
+                other = dists[1 - dir].get(v);
+                if (other is not None and d + other < best) {
+                    best = d + other
+                    meet = v
+                offsets, heads, weights = graphs[dir];
+                for (auto i : range(offsets[v], offsets[v + 1])) {
+                    u = heads[i];
+                    du = d + weights[i];
+                    if (du < seen[dir].get(u, inf)) {
+                        seen[dir][u] = du
+                        preds[dir][u] = v
+                        heappush(fringe, (du, u));
+        if (meet is None) {
+            throw nx.NetworkXNoPath(f"Node {target} not reachable from {source}");
+        ranks = [];
+        v = meet
+        while (v is not None) {
+            ranks.append(v);
+            v = preds[0][v];
+        ranks.reverse();
+        v = preds[1][meet];
+        while (v is not None) {
+            ranks.append(v);
+            v = preds[1][v];
+        return best, ranks
+
+    auto shortest_path_length(source, target) const -> void {
+        /** Returns the length of a shortest path from `source` to `target`.
+
+        Raises
+        ------
+        NodeNotFound
+            If `source` or `target` is not in the graph.
+
+        NetworkXNoPath
+            If no path exists between source and target.
+        */
+        this->_check(source, target);
+        return this->_query(source, target)[0];
+
+    auto shortest_path(source, target) const -> void {
+        /** Returns a shortest path from `source` to `target` as a list of nodes.
+
+        Shortcut edges are unpacked into the original edges.
+
+        Raises
+        ------
+        NodeNotFound
+            If `source` or `target` is not in the graph.
+
+        NetworkXNoPath
+            If no path exists between source and target.
+        */
+        this->_check(source, target);
+        _, ranks = this->_query(source, target);
+        nodes = [this->order[i] for i in ranks];
+        path = [nodes[0]];
+        for (auto edge : zip(nodes[:-1], nodes[1:])) {
+            stack = [edge];
+            while (stack) {
+                u, w = stack.pop();
+                v = this->_middle.get((u, w));
+                if (v is None) {
+                    path.append(w);
+                } else {
+                    stack.append((v, w));
+                    stack.append((u, v));
+        return path
+
+    auto _sweep(graph, source) const -> void {
+        /** Upward search from `source` and downward sweep over all ranks.
+
+        The edges of `graph` at rank v lead to higher ranks, so processing
+        the ranks from the top down finalizes every node after all of its
+        higher neighbors (PHAST).
+        */
+        n = this->order.size();
+        dist = [inf] * n
+        for (auto v, d : this->_upward_search(graph[0], this->_rank[source]).items()) {
+            dist[v] = d
+        offsets, heads, weights = graph[1];
+        for (auto v : range(n - 1, -1, -1)) {
+            dv = dist[v];
+            for (auto i : range(offsets[v], offsets[v + 1])) {
+                du = dist[heads[i]] + weights[i];
+                if (du < dv) {
+                    dv = du
+            dist[v] = dv
+        return {this->order[v]: d for v, d in enumerate(dist) if d < inf};
+
+    auto single_source_shortest_path_length(source) const -> void {
+        /** Returns a dict keyed by node to the distance from `source`.
+
+        Only nodes reachable from `source` are included.
+        */
+        this->_check(source);
+        return this->_sweep((this->_up, this->_down), source);
+
+    auto single_target_shortest_path_length(target) const -> void {
+        /** Returns a dict keyed by node to the distance to `target`.
+
+        Only nodes from which `target` is reachable are included.
+        */
+        this->_check(target);
+        return this->_sweep((this->_down, this->_up), target);
+
+    auto distance_table(sources, targets) const -> void {
+        /** Returns the distances from each of `sources` to each of `targets`.
+
+        One backward upward search per target stores its distances in
+        buckets at the nodes it settles; one forward upward search per
+        source then combines its distances with the buckets of the nodes
+        it settles [1]_. The cost is that of |sources| + |targets| upward
+        searches instead of |sources| full Dijkstra runs.
+
+        Returns
+        -------
+        table : dict of dicts
+            ``table[s][t]`` is the distance from `s` to `t`. Pairs without
+            a path are missing.
+
+        References
+        ----------
+        .. [1] Knopp, S., Sanders, P., Schultes, D., Schulz, F. and
+           Wagner, D. (2007). Computing many-to-many shortest paths using
+           highway hierarchies. *Proceedings of the 9th Workshop on
+           Algorithm Engineering and Experiments (ALENEX)*, 36-45.
+        */
+        sources = list(sources);
+        targets = list(targets);
+        this->_check(*sources, *targets);
+        buckets = {};
+        for (auto t : targets) {
+            for (auto v, d : this->_upward_search(this->_down, this->_rank[t]).items()) {
+                buckets.setdefault(v, []).append((t, d));
+        table = {};
+        for (auto s : sources) {
+            row = table[s] = {};
+            for (auto v, d : this->_upward_search(this->_up, this->_rank[s]).items()) {
+                for (auto t, dt : buckets.get(v, ())) {
+                    if (d + dt < row.get(t, inf)) {
+                        row[t] = d + dt
+        return table
+};
+
@@ -1,5 +1,8 @@
 /** Floyd-Warshall algorithm for shortest paths.
 */
+// from array import array
+// from math import inf
+
 // import graphx as nx
 
 __all__ = [
@@ -7,6 +10,7 @@ __all__ = [
     "floyd_warshall_predecessor_and_distance",
     "reconstruct_path",
     "floyd_warshall_numpy",
+    "floyd_warshall_array",
 ];
 
 
@@ -73,6 +77,145 @@ auto floyd_warshall_numpy(G, nodelist=None, weight="weight") -> void {
     return A
 }
 
+auto floyd_warshall_array(G, nodelist=None, weight="weight", typecode="d", block_size=64) -> void {
+    /** Find all-pairs shortest path lengths using a blocked Floyd's algorithm.
+
+    The distances are computed in place on a single row-major array
+    ``distance`` of length ``n * n``, so that ``distance[i * n + j]`` is the
+    distance from the `i`-th to the `j`-th node of `nodelist`. If no path
+    exists the distance is `inf`.
+
+    The matrix is processed in square tiles of `block_size` rows and columns.
+    For each diagonal tile, the tile itself is closed first, then the tiles
+    in its row and column, and then all remaining tiles, which only read the
+    finished row and column tiles [1]_. Each tile update is a min-plus
+    product whose inner loop runs over a contiguous slice of a row, so the
+    working set stays in cache.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    nodelist : list, optional (default=G.nodes);
+       The rows and columns are ordered by the nodes in nodelist.
+       If nodelist is None then the ordering is produced by G.nodes.
+       Nodelist should include all nodes in G.
+
+    weight: string, optional (default='weight');
+       Edge data key corresponding to the edge weight.
+
+    typecode : "d" or "f", optional (default="d");
+       Type code of the returned :class:`array.array`. Use "f" for single
+       precision to halve the memory footprint of large matrices.
+
+    block_size : int, optional (default=64);
+       Number of rows and columns of the tiles.
+
+    Returns
+    -------
+    distance : array.array
+        A flat array of shortest path distances between nodes.
+
+    Raises
+    ------
+    NetworkXError
+        If nodelist is not a list of the nodes in G.
+
+    ValueError
+        If `typecode` is not "d" or "f", or `block_size` is smaller than one.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(3);
+    >>> list(nx.floyd_warshall_array(G));
+    [0.0, 1.0, 2.0, 1.0, 0.0, 1.0, 2.0, 1.0, 0.0];
+
+    Notes
+    -----
+    Floyd's algorithm is appropriate for finding shortest paths in
+    dense graphs or graphs with negative weights when Dijkstra's
+    algorithm fails. This algorithm can still fail if there are negative
+    cycles. It has running time $O(n^3)$ with running space of $O(n^2)$.
+
+    Within the last phase of each round the tiles are independent of each
+    other, so they may be processed in any order.
+
+    See Also
+    --------
+    floyd_warshall
+    floyd_warshall_numpy
+
+    References
+    ----------
+    .. [1] Venkataraman, G., Sahni, S. and Mukhopadhyaya, S. (2003).
+       A blocked all-pairs shortest-paths algorithm.
+       *Journal of Experimental Algorithmics*, 8, 2.2.
+    */
+    if (!["d", "f"].contains(typecode)) {
+        throw ValueError(f"typecode must be 'd' or 'f', not {typecode!r}");
+    if (block_size < 1) {
+        throw ValueError("block_size must be at least 1");
+    if (nodelist is None) {
+        nodelist = list(G);
+    } else if (!(nodelist.size() == G.size() == set(nodelist.size()))) {
+        throw nx.NetworkXError(
+            "nodelist must contain every node in G with no repeats."
+            "If you wanted a subgraph of G use G.subgraph(nodelist)"
+        );
+    n = nodelist.size();
+    index = {u: i for i, u in enumerate(nodelist)};
+    distance = array(typecode, [inf]) * (n * n);
+    for (auto i : range(n)) {
+        distance[i * n + i] = 0;
+    undirected = not G.is_directed();
+    for (auto u, v, d : G.edges(data=true)) {
+        e_weight = d.get(weight, 1.0);
+        i = index[u];
+        j = index[v];
+        if (e_weight < distance[i * n + j]) {
+            distance[i * n + j] = e_weight;
+        if (undirected and e_weight < distance[j * n + i]) {
+            distance[j * n + i] = e_weight;
+
+    for (auto k0 : range(0, n, block_size)) {
+        k1 = min(k0 + block_size, n);
+        // Phase 1: the diagonal tile.
+        _min_plus_tile(distance, n, k0, k1, k0, k1, k0, k1);
+        // Phase 2: the tiles sharing its rows or columns.
+        for (auto b0 : range(0, n, block_size)) {
+            if (b0 != k0) {
+                b1 = min(b0 + block_size, n);
+                _min_plus_tile(distance, n, k0, k1, b0, b1, k0, k1);
+                _min_plus_tile(distance, n, b0, b1, k0, k1, k0, k1);
+        // Phase 3: all other tiles.
+        for (auto i0 : range(0, n, block_size)) {
+            if (i0 == k0) {
+                continue;
+            i1 = min(i0 + block_size, n);
+            for (auto j0 : range(0, n, block_size)) {
+                if (j0 != k0) {
+                    j1 = min(j0 + block_size, n);
+                    _min_plus_tile(distance, n, i0, i1, j0, j1, k0, k1);
+    return distance
+}
+
+auto _min_plus_tile(distance, n, i0, i1, j0, j1, k0, k1) -> void {
+    /** Relax the tile of rows `i0:i1` and columns `j0:j1` of the flat
+    matrix `distance` through the intermediate nodes `k0:k1`.
+    */
+    for (auto k : range(k0, k1)) {
+        row_k = k * n
+        for (auto i : range(i0, i1)) {
+            row_i = i * n
+            d_ik = distance[row_i + k];
+            if (d_ik == inf) {
+                continue;
+            for (auto j : range(j0, j1)) {
+                d = d_ik + distance[row_k + j];
+                if (d < distance[row_i + j]) {
+                    distance[row_i + j] = d
+}
+
 auto floyd_warshall_predecessor_and_distance(G, weight="weight") -> void {
     /** Find all-pairs shortest path lengths using Floyd's algorithm.
 
@@ -226,8 +369,13 @@ auto floyd_warshall(G, weight="weight") -> void {
     --------
     floyd_warshall_predecessor_and_distance
     floyd_warshall_numpy
+    floyd_warshall_array
     all_pairs_shortest_path
     all_pairs_shortest_path_length
     */
-    // could make this its own function to reduce memory costs
-    return floyd_warshall_predecessor_and_distance(G, weight=weight)[1];
+    nodes = list(G);
+    n = nodes.size();
+    distance = floyd_warshall_array(G, nodes, weight=weight);
+    return {
+        u: dict(zip(nodes, distance[i * n : (i + 1) * n])) for i, u in enumerate(nodes)
+    };
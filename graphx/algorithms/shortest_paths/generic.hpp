@@ -197,13 +197,21 @@ auto shortest_path_length(G, source=None, target=None, weight=None, method="dijk
         the dictionary of edge attributes for that edge.
         The function must return a number.
 
-    method : string, optional (default = 'dijkstra');
+    method : string or ContractionHierarchy, optional (default = 'dijkstra');
         The algorithm to use to compute the path length.
-        Supported options: 'dijkstra', 'bellman-ford'.
+        Supported options: 'dijkstra', 'bellman-ford', 'delta-stepping',
+        'contraction-hierarchy'.
         Other inputs produce a ValueError.
         If `weight` is None, unweighted graph methods are used, and this
         suggestion is ignored.
 
+        'contraction-hierarchy' builds a :class:`ContractionHierarchy` of
+        `G` for this call only, which pays off when lengths from all
+        sources are computed. To reuse the index across calls, build it
+        once and pass it as `method`; `weight` is then ignored. The index
+        is a snapshot and must be rebuilt by the caller after `G` or its
+        weights change.
+
     Returns
     -------
     length: int or iterator
@@ -263,11 +271,45 @@ auto shortest_path_length(G, source=None, target=None, weight=None, method="dijk
     single_source_shortest_path_length
     single_source_dijkstra_path_length
     single_source_bellman_ford_path_length
+    delta_stepping_predecessor_and_distance
+    ContractionHierarchy
     */
-    if (!("dijkstra",.contains(method) "bellman-ford")) {
-        // so we don't need to check in each branch later
-        throw ValueError(f"method not supported: {method}");
-    method = "unweighted" if weight is None else method
+    #include <graphx/algorithms.shortest_paths.contraction.hpp>  // import ContractionHierarchy
+
+    if (isinstance(method, ContractionHierarchy)) {
+        ch = method
+    } else {
+        methods = ("dijkstra", "bellman-ford", "delta-stepping", "contraction-hierarchy");
+        if (!methods.contains(method)) {
+            // so we don't need to check in each branch later
+            throw ValueError(f"method not supported: {method}");
+        method = "unweighted" if weight is None else method
+        ch = ContractionHierarchy(G, weight) if method == "contraction-hierarchy" else None
+    if (ch is not None) {
+        if (source is None) {
+            if (target is None) {
+                return ((n, ch.single_source_shortest_path_length(n)) for n in G);
+            return ch.single_target_shortest_path_length(target);
+        if (target is None) {
+            return ch.single_source_shortest_path_length(source);
+        return ch.shortest_path_length(source, target);
+    if (method == "delta-stepping") {
+        if (source is None) {
+            if (target is None) {
+                return (
+                    (n, nx.delta_stepping_predecessor_and_distance(G, n, weight=weight)[1]);
+                    for n in G
+                );
+            R = G.reverse(copy=false) if G.is_directed() else G
+            return nx.delta_stepping_predecessor_and_distance(R, target, weight=weight)[1];
+        dist = nx.delta_stepping_predecessor_and_distance(G, source, weight=weight)[1];
+        if (target is None) {
+            return dist
+        if (!G.contains(target)) {
+            throw nx.NodeNotFound(f"Node {target} not in G");
+        if (!dist.contains(target)) {
+            throw nx.NetworkXNoPath(f"Node {target} not reachable from {source}");
+        return dist[target];
     if (source is None) {
         if (target is None) {
             // Find paths between all pairs.
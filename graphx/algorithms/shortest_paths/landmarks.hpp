@@ -0,0 +1,162 @@
+/** Landmark-based (ALT) lower bounds for point-to-point shortest paths.
+*/
+
+// from math import inf
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import py_random_state
+
+// __all__= ["ALTIndex"];
+
+
+class ALTIndex {
+    /** Landmark index giving admissible A* heuristics (ALT).
+
+    A small set of landmark nodes is chosen and the distances from every
+    landmark to every node (and, for directed graphs, from every node to
+    every landmark) are computed once. By the triangle inequality,
+
+        d(u, v) >= d(L, v) - d(L, u)   and   d(u, v) >= d(u, L) - d(v, L)
+
+    for every landmark L, and the largest of these bounds is a consistent
+    heuristic for A* search [1]_. Good landmarks lie "behind" the source
+    or target, so they are picked by farthest-point selection: each new
+    landmark is the node farthest from the landmarks chosen so far.
+
+    The index is itself a function ``index(u, v)`` and can be passed as the
+    `heuristic` of :func:`astar_path`, :func:`astar_path_length` and
+    :func:`bidirectional_dijkstra`.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    num_landmarks : int, optional (default=16);
+        Number of landmarks. More landmarks give tighter bounds at the cost
+        of memory (two floats per node and landmark for directed graphs,
+        one for undirected graphs) and slower heuristic evaluations.
+        Fewer landmarks are used if `G` has fewer nodes.
+
+    weight : string or function
+        If this is a string, then edge weights will be accessed via the
+        edge attribute with this key (that is, the weight of the edge
+        joining `u` to `v` will be ``G.edges[u, v][weight]``). If no
+        such edge attribute exists, the weight of the edge is assumed to
+        be one.
+
+        If this is a function, the weight of an edge is the value
+        returned by the function. The function must accept exactly three
+        positional arguments: the two endpoints of an edge and the
+        dictionary of edge attributes for that edge. The function must
+        return a number.
+
+        The searches using the index must use the same weights.
+
+    seed : integer, random_state, or None (default);
+        Indicator of random number generation state.
+        See :ref:`Randomness<randomness>`.
+        Used to choose the node from which the first landmark is found.
+
+    Attributes
+    ----------
+    landmarks : list
+        The landmark nodes in the order they were selected.
+
+    Raises
+    ------
+    NetworkXPointlessConcept
+        If `G` is the null graph.
+
+    ValueError
+        If `num_landmarks` is smaller than one.
+
+    Examples
+    --------
+    >>> G = nx.grid_2d_graph(20, 20);
+    >>> index = nx.ALTIndex(G, num_landmarks=4, seed=42);
+    >>> index((0, 0), (19, 19));
+    38
+    >>> nx.astar_path_length(G, (0, 0), (19, 19), heuristic=index);
+    38
+    >>> length, path = nx.bidirectional_dijkstra(G, (0, 0), (5, 5), heuristic=index);
+    >>> length
+    10
+
+    Notes
+    -----
+    Edge weights must be nonnegative. The index is a snapshot: after edges
+    are added, removed or reweighted it has to be rebuilt, otherwise the
+    heuristic may overestimate distances.
+
+    The shortest path computations from the landmarks are independent of
+    each other apart from the choice of the next landmark.
+
+    References
+    ----------
+    .. [1] Goldberg, A. V. and Harrelson, C. (2005).
+       Computing the shortest path: A* search meets graph theory.
+       *Proceedings of the 16th ACM-SIAM Symposium on Discrete Algorithms*,
+       156-165.
+    */
+
+    // @py_random_state(4);
+    auto __init__(G, num_landmarks=16, weight="weight", seed=None) const -> void {
+        if (G.size() == 0) {
+            throw nx.NetworkXPointlessConcept("ALTIndex of the null graph is undefined.");
+        if (num_landmarks < 1) {
+            throw ValueError("num_landmarks must be at least 1");
+        this->directed = G.is_directed();
+        R = G.reverse(copy=false) if this->directed else G
+
+        // Distances from and to each landmark, as one list per node so that
+        // a heuristic evaluation touches only two lists.
+        this->_from = {n: [] for n in G};
+        this->_to = {n: [] for n in G} if this->directed else this->_from
+        this->landmarks = [];
+
+        // The first landmark is the node farthest from a random node.
+        start = seed.choice(list(G));
+        dist = nx.single_source_dijkstra_path_length(G, start, weight=weight);
+        // Distance to the closest landmark, -1 for the landmarks themselves.
+        closest = {n: inf for n in G};
+        landmark = max(G, key=lambda n: dist.get(n, -1));
+        while (true) {
+            this->landmarks.append(landmark);
+            dist = nx.single_source_dijkstra_path_length(G, landmark, weight=weight);
+            for (auto n, row : this->_from.items()) {
+                d = dist.get(n, inf);
+                row.append(d);
+                if (d < closest[n]) {
+                    closest[n] = d
+            if (this->directed) {
+                dist = nx.single_source_dijkstra_path_length(R, landmark, weight=weight);
+                for (auto n, row : this->_to.items()) {
+                    row.append(dist.get(n, inf));
+            closest[landmark] = -1;
+            if (this->landmarks.size() == num_landmarks) {
+                break;
+            // Nodes not reachable from any landmark come first.
+            landmark = max(closest, key=closest.__getitem__);
+            if (closest[landmark] <= 0) {
+                break;
+
+    auto __call__(u, v) const -> void {
+        /** Returns a lower bound on the distance from `u` to `v`.*/
+        return this->heuristic(u, v);
+
+    auto heuristic(u, v) const -> void {
+        /** Returns a lower bound on the distance from `u` to `v`.
+
+        Landmarks which cannot reach or be reached from both nodes give no
+        bound and are skipped.
+        */
+        bound = 0;
+        for (auto from_u, from_v, to_u, to_v : zip(
+            this->_from[u], this->_from[v], this->_to[u], this->_to[v]
+        )) {
+            if (from_u < inf and from_v < inf and from_v - from_u > bound) {
+                bound = from_v - from_u
+            if (to_u < inf and to_v < inf and to_u - to_v > bound) {
+                bound = to_u - to_v
+        return bound
+};
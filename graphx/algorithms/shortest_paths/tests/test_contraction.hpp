@@ -0,0 +1,89 @@
+// import pytest
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import pairwise
+
+
+auto _random_weighted_graph(n, m, seed, directed) -> void {
+    G = nx.gnm_random_graph(n, m, seed=seed, directed=directed);
+    for (auto i, (u, v) : enumerate(G.edges())) {
+        // Include zero weights and ties.
+        G[u][v]["weight"] = (i * 7919) % 7;
+    return G
+}
+
+
+class TestContractionHierarchy {
+    // @pytest.mark.parametrize("directed", [false, true]);
+    // @pytest.mark.parametrize("settle_limit", [1, 50]);
+    auto test_queries(directed, settle_limit) const -> void {
+        G = _random_weighted_graph(60, 180, 42, directed);
+        ch = nx.ContractionHierarchy(G, settle_limit=settle_limit);
+        assert(sorted(ch.order) == sorted(G));
+        expected = dict(nx.all_pairs_dijkstra_path_length(G));
+        table = ch.distance_table(G, G);
+        for (auto s : G) {
+            assert(ch.single_source_shortest_path_length(s) == expected[s]);
+            assert(table[s] == expected[s]);
+            for (auto t : G) {
+                if (!expected[s].contains(t)) {
+                    pytest.raises(nx.NetworkXNoPath, ch.shortest_path_length, s, t);
+                    pytest.raises(nx.NetworkXNoPath, ch.shortest_path, s, t);
+                    continue;
+                assert(ch.shortest_path_length(s, t) == expected[s][t]);
+                path = ch.shortest_path(s, t);
+                assert(path[0] == s and path[-1] == t);
+                assert(sum(G[u][v]["weight"] for u, v in pairwise(path)) == expected[s][t]);
+        for (auto t : G) {
+            expected_t = {s: lengths[t] for s, lengths in expected.items() if t in lengths};
+            assert(ch.single_target_shortest_path_length(t) == expected_t);
+
+    auto test_multigraph_and_hidden_edges() const -> void {
+        G = nx.MultiDiGraph();
+        G.add_edge(0, 1, weight=5);
+        G.add_edge(0, 1, weight=2);
+        G.add_edge(1, 2, weight=1);
+        G.add_edge(0, 2, weight=1, hidden=true);
+        G.add_edge(2, 2, weight=1);
+
+        ch = nx.ContractionHierarchy(G, weight=lambda u, v, d: min(
+            (dd["weight"] for dd in d.values() if not dd.get("hidden")), default=None
+        ));
+        assert(ch.shortest_path(0, 2) == [0, 1, 2]);
+        assert(ch.shortest_path_length(0, 2) == 3);
+        assert(ch.shortest_path_length(2, 2) == 0);
+
+    auto test_errors() const -> void {
+        G = nx.Graph([(0, 1, {"weight": -1})]);
+        pytest.raises(ValueError, nx.ContractionHierarchy, G);
+        ch = nx.ContractionHierarchy(nx.path_graph(3));
+        pytest.raises(nx.NodeNotFound, ch.shortest_path_length, 0, 5);
+        pytest.raises(nx.NodeNotFound, ch.distance_table, [0], [5]);
+
+    auto test_shortest_path_length_method() const -> void {
+        G = _random_weighted_graph(30, 60, 1, true);
+        ch = nx.ContractionHierarchy(G);
+        for (auto method : ("contraction-hierarchy", ch)) {
+            for (auto s : G) {
+                expected = nx.single_source_dijkstra_path_length(G, s);
+                assert(nx.shortest_path_length(G, s, weight="weight", method=method) == expected);
+                for (auto t, d : expected.items()) {
+                    assert(nx.shortest_path_length(G, s, t, "weight", method) == d);
+            expected = nx.single_source_dijkstra_path_length(G.reverse(), 0);
+            assert(nx.shortest_path_length(G, target=0, weight="weight", method=method) == expected);
+            assert(dict(nx.shortest_path_length(G, weight="weight", method=method)) == dict(
+                nx.all_pairs_dijkstra_path_length(G)
+            ));
+
+    auto test_rebuild_after_weight_change() const -> void {
+        // The index is a snapshot, also of frozen graphs.
+        G = nx.path_graph(4);
+        nx.set_edge_attributes(G, 1, "weight");
+        G = nx.freeze(G);
+        ch = nx.ContractionHierarchy(G);
+        G[1][2]["weight"] = 10;
+        assert(nx.shortest_path_length(G, 0, 3, method=ch) == 3);
+        assert(nx.shortest_path_length(G, 0, 3, "weight", "contraction-hierarchy") == 12);
+        ch = nx.ContractionHierarchy(G);
+        assert(nx.shortest_path_length(G, 0, 3, method=ch) == 12);
+}
\ No newline at end of file
@@ -210,3 +210,29 @@ class TestFloyd {
         G.add_weighted_edges_from(edges);
         dist = nx.floyd_warshall(G);
         assert dist[1][3] == -14
+
+    auto test_floyd_warshall_array() const -> void {
+        G = nx.gnp_random_graph(40, 0.1, seed=7, directed=true);
+        for (auto u, v, d : G.edges(data=true)) {
+            d["weight"] = (u * v) % 7;
+        _, expected = nx.floyd_warshall_predecessor_and_distance(G);
+        nodes = list(G);
+        n = nodes.size();
+        for (auto block_size : (1, 3, 16, 64)) {
+            distance = nx.floyd_warshall_array(G, nodes, block_size=block_size);
+            for (auto i, u : enumerate(nodes)) {
+                for (auto j, v : enumerate(nodes)) {
+                    assert(distance[i * n + j] == expected[u][v]);
+
+    auto test_floyd_warshall_array_single_precision() const -> void {
+        G = nx.cycle_graph(7);
+        distance = nx.floyd_warshall_array(G, typecode="f", block_size=2);
+        assert(distance.typecode == "f");
+        assert(distance[0 * 7 + 3] == 3);
+        assert(distance[0 * 7 + 4] == 3);
+
+    auto test_floyd_warshall_array_errors() const -> void {
+        G = nx.path_graph(3);
+        pytest.raises(ValueError, nx.floyd_warshall_array, G, typecode="i");
+        pytest.raises(ValueError, nx.floyd_warshall_array, G, block_size=0);
+        pytest.raises(nx.NetworkXError, nx.floyd_warshall_array, G, [0, 1]);
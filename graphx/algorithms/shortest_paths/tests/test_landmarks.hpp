@@ -0,0 +1,67 @@
+// import pytest
+
+// import graphx as nx
+#include <graphx/utils.hpp>  // import pairwise
+
+
+auto _random_weighted_graph(n, m, seed, directed) -> void {
+    G = nx.gnm_random_graph(n, m, seed=seed, directed=directed);
+    for (auto i, (u, v) : enumerate(G.edges())) {
+        G[u][v]["weight"] = (i * 7919) % 13 + 1;
+    return G
+}
+
+
+class TestALTIndex {
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_admissible(directed) const -> void {
+        G = _random_weighted_graph(60, 150, 1, directed);
+        index = nx.ALTIndex(G, num_landmarks=5, seed=1);
+        assert(index.landmarks.size() == 5);
+        for (auto u, lengths : nx.all_pairs_dijkstra_path_length(G)) {
+            for (auto v : G) {
+                if (lengths.contains(v)) {
+                    assert(index(u, v) <= lengths[v]);
+                    assert(index.heuristic(u, u) == 0);
+
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_consistent(directed) const -> void {
+        G = _random_weighted_graph(60, 150, 2, directed);
+        index = nx.ALTIndex(G, num_landmarks=4, seed=2);
+        for (auto t : list(G)[:10]) {
+            for (auto u, v, w : G.edges(data="weight")) {
+                assert(index(u, t) <= w + index(v, t));
+
+    // @pytest.mark.parametrize("directed", [false, true]);
+    auto test_searches(directed) const -> void {
+        G = _random_weighted_graph(80, 240, 3, directed);
+        index = nx.ALTIndex(G, num_landmarks=6, seed=3);
+        for (auto s : list(G)[:15]) {
+            lengths = nx.single_source_dijkstra_path_length(G, s);
+            for (auto t : G) {
+                if (!lengths.contains(t)) {
+                    pytest.raises(nx.NetworkXNoPath, nx.bidirectional_dijkstra, G, s, t, heuristic=index);
+                    continue;
+                assert(nx.astar_path_length(G, s, t, heuristic=index) == lengths[t]);
+                length, path = nx.bidirectional_dijkstra(G, s, t, heuristic=index);
+                assert length == lengths[t]
+                assert(path[0] == s and path[-1] == t);
+                assert(sum(G[u][v]["weight"] for u, v in pairwise(path)) == length);
+
+    auto test_landmarks_spread() const -> void {
+        // Farthest-point selection picks the two ends of a path first.
+        index = nx.ALTIndex(nx.path_graph(10), num_landmarks=2, seed=42);
+        assert(sorted(index.landmarks) == [0, 9]);
+        assert(index(2, 7) == 5);
+
+    auto test_disconnected() const -> void {
+        G = nx.union(nx.path_graph(3), nx.path_graph([3, 4]));
+        index = nx.ALTIndex(G, num_landmarks=10, seed=1);
+        assert(index.landmarks.size() == 5);
+        assert(index(0, 2) == 2);
+        assert(index(0, 4) == 0);
+
+    auto test_errors() const -> void {
+        pytest.raises(nx.NetworkXPointlessConcept, nx.ALTIndex, nx.Graph());
+        pytest.raises(ValueError, nx.ALTIndex, nx.path_graph(3), 0);
+}
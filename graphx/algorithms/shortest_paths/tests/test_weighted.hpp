@@ -1,4 +1,5 @@
 // import pytest
+// import random
 
 // import graphx as nx
 #include <graphx/utils.hpp>  // import pairwise
@@ -493,6 +494,65 @@ class TestMultiSourceDijkstra {
         assert(paths == {n: list(range(n + 1)) for n in G});
 }
 
+class TestDeltaStepping : public WeightedTestBase {
+    // @staticmethod
+    auto _check(G, source, **kwargs) -> void {
+        pred, dist = nx.dijkstra_predecessor_and_distance(G, source);
+        ds_pred, ds_dist = nx.delta_stepping_predecessor_and_distance(G, source, **kwargs);
+        assert ds_dist == dist
+        assert({v: sorted(p) for v, p in ds_pred.items()} == {
+            v: sorted(p) for v, p in pred.items()
+        });
+
+    // @pytest.mark.parametrize("delta", [None, 0.5, 1, 3, 1000]);
+    auto test_matches_dijkstra(delta) const -> void {
+        for (auto G : (this->XG, this->XG2, this->XG3, this->XG4, this->MXG, this->grid)) {
+            for (auto source : list(G)[:5]) {
+                this->_check(G, source, delta=delta);
+
+    // @pytest.mark.parametrize("seed", range(5));
+    auto test_random_graphs(seed) const -> void {
+        G = nx.gnm_random_graph(100, 400, seed=seed, directed=seed % 2 == 0);
+        for (auto i, (u, v) : enumerate(G.edges)) {
+            // Zero weights and ties create several predecessors.
+            G.edges[u, v]["weight"] = (i * (seed + 3)) % 9;
+        for (auto source : range(0, 100, 10)) {
+            this->_check(G, source);
+            this->_check(G, source, delta=2);
+
+    auto test_hidden_edges() const -> void {
+        G = nx.Graph([(0, 1), (1, 2), (0, 2)]);
+        weight = lambda u, v, d: None if {u, v} == {0, 2} else 1
+        pred, dist = nx.delta_stepping_predecessor_and_distance(G, 0, weight=weight);
+        assert dist == {0: 0, 1: 1, 2: 2}
+        assert pred == {0: [], 1: [0], 2: [1]}
+
+    auto test_errors() const -> void {
+        G = nx.path_graph(3);
+        pytest.raises(nx.NodeNotFound, nx.delta_stepping_predecessor_and_distance, G, 3);
+        pytest.raises(ValueError, nx.delta_stepping_predecessor_and_distance, G, 0, 0);
+        G.add_edge(1, 2, weight=-1);
+        pytest.raises(ValueError, nx.delta_stepping_predecessor_and_distance, G, 0);
+
+    auto test_shortest_path_length_method() const -> void {
+        G = this->XG
+        method = "delta-stepping"
+        assert(nx.shortest_path_length(G, "s", "v", "weight", method) == 9);
+        assert(nx.shortest_path_length(G, "s", weight="weight", method=method) == dict(
+            nx.single_source_dijkstra_path_length(G, "s")
+        ));
+        assert(nx.shortest_path_length(G, target="v", weight="weight", method=method) == dict(
+            nx.single_source_dijkstra_path_length(G.reverse(), "v")
+        ));
+        assert(dict(nx.shortest_path_length(G, weight="weight", method=method)) == dict(
+            nx.all_pairs_dijkstra_path_length(G)
+        ));
+        G = nx.DiGraph([(0, 1)]);
+        G.add_node(2);
+        pytest.raises(nx.NetworkXNoPath, nx.shortest_path_length, G, 1, 0, "weight", method);
+        pytest.raises(nx.NodeNotFound, nx.shortest_path_length, G, 0, 3, "weight", method);
+}
+
 class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
     auto test_single_node_graph() const -> void {
         G = nx.DiGraph();
@@ -502,6 +562,7 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
         assert(nx.single_source_bellman_ford(G, 0) == ({0: 0}, {0: [0]}));
         assert(nx.bellman_ford_predecessor_and_distance(G, 0) == ({0: []}, {0: 0}));
         assert(nx.goldberg_radzik(G, 0) == ({0: None}, {0: 0}));
+        assert(nx.tarjan_bellman_ford(G, 0) == ({0: None}, {0: 0}));
 
     auto test_absent_source_bellman_ford() const -> void {
         // the check is in _bellman_ford; this provides regression testing
@@ -523,6 +584,11 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
             G = nx.path_graph(2);
             nx.goldberg_radzik(G, 3, 0);
 
+    auto test_absent_source_tarjan_bellman_ford() const -> void {
+        with pytest.raises(nx.NodeNotFound):
+            G = nx.path_graph(2);
+            nx.tarjan_bellman_ford(G, 3, 0);
+
     auto test_negative_cycle_heuristic() const -> void {
         G = nx.DiGraph();
         G.add_edge(0, 1, weight=-1);
@@ -567,6 +633,7 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
                 nx.NetworkXUnbounded, nx.bellman_ford_predecessor_and_distance, G, i
             );
             pytest.raises(nx.NetworkXUnbounded, nx.goldberg_radzik, G, i);
+            pytest.raises(nx.NetworkXUnbounded, nx.tarjan_bellman_ford, G, i);
         G = nx.cycle_graph(5); // undirected Graph
         G.add_edge(1, 2, weight=-3);
         for (auto i : range(5)) {
@@ -581,6 +648,7 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
                 nx.NetworkXUnbounded, nx.bellman_ford_predecessor_and_distance, G, i
             );
             pytest.raises(nx.NetworkXUnbounded, nx.goldberg_radzik, G, i);
+            pytest.raises(nx.NetworkXUnbounded, nx.tarjan_bellman_ford, G, i);
         G = nx.DiGraph([(1, 1, {"weight": -1})]);
         pytest.raises(nx.NetworkXUnbounded, nx.single_source_bellman_ford_path, G, 1);
         pytest.raises(
@@ -591,13 +659,17 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
             nx.NetworkXUnbounded, nx.bellman_ford_predecessor_and_distance, G, 1
         );
         pytest.raises(nx.NetworkXUnbounded, nx.goldberg_radzik, G, 1);
+        pytest.raises(nx.NetworkXUnbounded, nx.tarjan_bellman_ford, G, 1);
 
     auto test_find_negative_cycle_longer_cycle() const -> void {
         G = nx.cycle_graph(5, create_using=nx.DiGraph());
         nx.add_cycle(G, [3, 5, 6, 7, 8, 9]);
         G.add_edge(1, 2, weight=-30);
-        assert(nx.find_negative_cycle(G, 1) == [0, 1, 2, 3, 4, 0]);
-        assert(nx.find_negative_cycle(G, 7) == [2, 3, 4, 0, 1, 2]);
+        for (auto source : (1, 7)) {
+            cycle = nx.find_negative_cycle(G, source);
+            assert(cycle[0] == cycle[-1]);
+            assert(set(cycle) == {0, 1, 2, 3, 4});
+            assert(sum(G[u][v].get("weight", 1) for u, v in pairwise(cycle)) < 0);
 
     auto test_find_negative_cycle_no_cycle() const -> void {
         G = nx.path_graph(5, create_using=nx.DiGraph());
@@ -606,7 +678,11 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
     auto test_find_negative_cycle_single_edge() const -> void {
         G = nx.Graph();
         G.add_edge(0, 1, weight=-1);
-        assert(nx.find_negative_cycle(G, 1) == [1, 0, 1]);
+        cycle = nx.find_negative_cycle(G, 1);
+        assert(cycle[0] == cycle[-1] and sorted(cycle[:-1]) == [0, 1]);
+        G = nx.DiGraph([(0, 0, {"weight": -1})]);
+        assert(nx.find_negative_cycle(G, 0) == [0, 0]);
+        pytest.raises(nx.NodeNotFound, nx.find_negative_cycle, G, 1);
 
     auto test_negative_weight() const -> void {
         G = nx.cycle_graph(5, create_using=nx.DiGraph());
@@ -857,6 +933,41 @@ class TestBellmanFordAndGoldbergRadzik : public WeightedTestBase {
         nx.dijkstra_path(D, 1, 3);
         nx.bidirectional_dijkstra(D, 1, 3);
         // FIXME nx.goldberg_radzik(D, 1);
+        assert(nx.tarjan_bellman_ford(D, 1)[1] == {1: 0, 2: 1, 3: 2});
+
+    auto test_tarjan_bellman_ford_random() const -> void {
+        rng = random.Random(42);
+        for (auto i : range(50)) {
+            G = nx.gnp_random_graph(15, 0.2, seed=i, directed=true);
+            for (auto u, v, d : G.edges(data=true)) {
+                d["weight"] = rng.randint(-2, 10);
+            try {
+                expected = nx.bellman_ford_predecessor_and_distance(G, 0)[1];
+            } catch (nx.NetworkXUnbounded) {
+                pytest.raises(nx.NetworkXUnbounded, nx.tarjan_bellman_ford, G, 0);
+                continue;
+            pred, dist = nx.tarjan_bellman_ford(G, 0);
+            assert(dist == expected);
+            for (auto v, u : pred.items()) {
+                if (u is not None) {
+                    assert(dist[v] == dist[u] + G[u][v]["weight"]);
+
+    auto test_tarjan_bellman_ford_float_weights() const -> void {
+        // The running sum of the queued labels rounds to below 0.9.
+        G = nx.DiGraph([(0, 1, {"weight": 1.0}), (0, 2, {"weight": 0.9})]);
+        assert(nx.tarjan_bellman_ford(G, 0)[1] == {0: 0, 1: 1.0, 2: 0.9});
+        rng = random.Random(42);
+        for (auto i : range(50)) {
+            G = nx.gnp_random_graph(15, 0.2, seed=i, directed=true);
+            for (auto u, v, d : G.edges(data=true)) {
+                d["weight"] = rng.uniform(-0.5, 3);
+            try {
+                expected = nx.bellman_ford_predecessor_and_distance(G, 0)[1];
+            } catch (nx.NetworkXUnbounded) {
+                assert(nx.negative_edge_cycle(G));
+                continue;
+            dist = nx.tarjan_bellman_ford(G, 0)[1];
+            assert(dist == pytest.approx(expected));
 };
 
 class TestJohnsonAlgorithm : public WeightedTestBase {
@@ -5,6 +5,7 @@ Shortest path algorithms for weighted graphs.
 // from collections import deque
 // from heapq import heappop, heappush
 // from itertools import count
+// from math import inf
 
 // import graphx as nx
 #include <graphx/algorithms.shortest_paths.generic.hpp>  // import _build_paths_from_predecessors
@@ -23,6 +24,7 @@ __all__ = [
     "all_pairs_dijkstra_path",
     "all_pairs_dijkstra_path_length",
     "dijkstra_predecessor_and_distance",
+    "delta_stepping_predecessor_and_distance",
     "bellman_ford_path",
     "bellman_ford_path_length",
     "single_source_bellman_ford",
@@ -34,6 +36,7 @@ __all__ = [
     "negative_edge_cycle",
     "find_negative_cycle",
     "goldberg_radzik",
+    "tarjan_bellman_ford",
     "johnson",
 ];
 
@@ -935,6 +938,164 @@ auto dijkstra_predecessor_and_distance(G, source, cutoff=None, weight="weight")
     return (pred, _dijkstra(G, source, weight, pred=pred, cutoff=cutoff));
 }
 
+auto delta_stepping_predecessor_and_distance(G, source, delta=None, weight="weight") -> void {
+    /** Compute weighted shortest path lengths and predecessors by delta-stepping.
+
+    Returns the same predecessors and distances as
+    :func:`dijkstra_predecessor_and_distance`, computed with the
+    delta-stepping algorithm of Meyer and Sanders [1]_.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    source : node label
+        Starting node for path
+
+    delta : number, optional (default=None);
+        Width of the distance buckets. Edges of weight at most `delta` are
+        light, the others heavy. If None, the maximum edge weight divided by
+        the average degree is used, which suits graphs whose weights are
+        spread out evenly.
+
+    weight : string or function
+        If this is a string, then edge weights will be accessed via the
+        edge attribute with this key (that is, the weight of the edge
+        joining `u` to `v` will be ``G.edges[u, v][weight]``). If no
+        such edge attribute exists, the weight of the edge is assumed to
+        be one.
+
+        If this is a function, the weight of an edge is the value
+        returned by the function. The function must accept exactly three
+        positional arguments: the two endpoints of an edge and the
+        dictionary of edge attributes for that edge. The function must
+        return a number or None to indicate a hidden edge.
+
+    Returns
+    -------
+    pred, distance : dictionaries
+        Returns two dictionaries representing a list of predecessors
+        of a node and the distance to each node.
+
+    Raises
+    ------
+    NodeNotFound
+        If `source` is not in `G`.
+
+    ValueError
+        If `delta` is not positive or `G` has a negative edge weight.
+
+    Notes
+    -----
+    Nodes are kept in buckets of tentative distances ``[i * delta, (i + 1)
+    * delta)``. The smallest nonempty bucket is emptied repeatedly by
+    relaxing the light edges of its nodes, which may refill it; the heavy
+    edges of all nodes removed from it are relaxed once afterwards, since
+    they cannot lead back into it. Each phase first collects all
+    relaxation requests and then applies them, so the nodes of a bucket
+    can be processed independently of each other. With ``delta`` at most
+    the smallest edge weight this is Dijkstra's algorithm, with a huge
+    ``delta`` it is Bellman-Ford.
+
+    The order of the predecessor lists may differ from
+    :func:`dijkstra_predecessor_and_distance`.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(5, create_using=nx.DiGraph());
+    >>> pred, dist = nx.delta_stepping_predecessor_and_distance(G, 0);
+    >>> sorted(pred.items());
+    [(0, []), (1, [0]), (2, [1]), (3, [2]), (4, [3])];
+    >>> sorted(dist.items());
+    [(0, 0), (1, 1), (2, 2), (3, 3), (4, 4)];
+
+    See Also
+    --------
+    dijkstra_predecessor_and_distance
+
+    References
+    ----------
+    .. [1] Meyer, U. and Sanders, P. (2003). Delta-stepping: a
+       parallelizable shortest path algorithm. *Journal of Algorithms*,
+       49(1), 114-152.
+    */
+    if (!G.contains(source)) {
+        throw nx.NodeNotFound(f"Node {source} is not found in the graph");
+    if (delta is not None and delta <= 0) {
+        throw ValueError("delta must be positive");
+    weight = _weight_function(G, weight);
+
+    // Read every weight once.
+    edges = {};
+    max_weight = 0;
+    num_edges = 0;
+    for (auto u, nbrs : G._adj.items()) {
+        edges[u] = row = [];
+        for (auto v, e : nbrs.items()) {
+            cost = weight(u, v, e);
+            if (cost is None) {
+                continue;
+            if (cost < 0) {
+                throw ValueError("delta-stepping needs nonnegative weights.");
+            row.append((v, cost));
+            max_weight = max(max_weight, cost);
+        num_edges += row.size();
+    if (delta is None) {
+        delta = max_weight / max(num_edges / G.size(), 1) if max_weight > 0 else 1
+    light = {u: [(v, c) for v, c in row if c <= delta] for u, row in edges.items()};
+    heavy = {u: [(v, c) for v, c in row if c > delta] for u, row in edges.items()};
+
+    dist = {};  // tentative distances, final at the end
+    buckets = {};
+    indices = [];  // heap of the indices of nonempty buckets
+
+    auto relax(v, d) -> void {
+        if (d < dist.get(v, inf)) {
+            if (dist.contains(v)) {
+                buckets[int(dist[v] // delta)].discard(v);
+            dist[v] = d
+            i = int(d // delta);
+            if (!buckets.contains(i)) {
+                buckets[i] = set();
+                heappush(indices, i);
+            buckets[i].add(v);
+
+    relax(source, 0);
+    while (indices) {
+        i = heappop(indices);
+        bucket = buckets.pop(i);
+        removed = [];
+        while (bucket) {
+            requests = [(w, dist[v] + c) for v in bucket for w, c in light[v]];
+            removed.extend(bucket);
+            bucket.clear();
+            for (auto w, d : requests) {
+                if (d < dist.get(w, inf)) {
+                    // Light edges may lead back into the current bucket.
+                    if (int(d // delta) == i) {
+                        if (dist.contains(w) and int(dist[w] // delta) != i) {
+                            buckets[int(dist[w] // delta)].discard(w);
+                        dist[w] = d
+                        bucket.add(w);
+                    } else {
+                        relax(w, d);
+        requests = [(w, dist[v] + c) for v in removed for w, c in heavy[v]];
+        for (auto w, d : requests) {
+            relax(w, d);
+
+    // A node is a predecessor if the edge from it is tight.
+    G_pred = G._pred if G.is_directed() else G._adj
+    pred = {};
+    for (auto v, d : dist.items()) {
+        pred[v] = [];
+        for (auto u, e : G_pred[v].items()) {
+            if (dist.contains(u)) {
+                cost = weight(u, v, e);
+                if (cost is not None and dist[u] + cost == d) {
+                    pred[v].append(u);
+    return (pred, dist);
+}
+
 auto all_pairs_dijkstra(G, cutoff=None, weight="weight") -> void {
     /** Find shortest weighted paths and lengths between all nodes.
 
@@ -2068,6 +2229,240 @@ auto goldberg_radzik(G, source, weight="weight") -> void {
     return pred, d
 }
 
+auto tarjan_bellman_ford(G, source, weight="weight") -> void {
+    /** Compute shortest path lengths and predecessors on shortest paths
+    in weighted graphs with Tarjan's subtree disassembly.
+
+    This is a queue-based Bellman–Ford (label-correcting) algorithm. Whenever
+    the distance of a node `v` is lowered, the nodes of the subtree of the
+    current shortest path tree rooted at `v` are detached and removed from
+    the queue, since their labels are about to be lowered again through `v`.
+    This avoids many useless scans and detects a negative cycle as soon as
+    one closes in the tree, instead of after `n` passes [1]_. The queue uses
+    the Small Label First and Large Label Last rules [2]_, and the graph is
+    copied once into arrays so that the relaxations do not touch the
+    adjacency dicts.
+
+    Parameters
+    ----------
+    G : GraphX graph
+        The algorithm works for all types of graphs, including directed
+        graphs and multigraphs.
+
+    source: node label
+        Starting node for path
+
+    weight : string or function
+        If this is a string, then edge weights will be accessed via the
+        edge attribute with this key (that is, the weight of the edge
+        joining `u` to `v` will be ``G.edges[u, v][weight]``). If no
+        such edge attribute exists, the weight of the edge is assumed to
+        be one.
+
+        If this is a function, the weight of an edge is the value
+        returned by the function. The function must accept exactly three
+        positional arguments: the two endpoints of an edge and the
+        dictionary of edge attributes for that edge. The function must
+        return a number.
+
+    Returns
+    -------
+    pred, dist : dictionaries
+        Returns two dictionaries keyed by node to predecessor in the
+        path and to the distance from the source respectively.
+
+    Raises
+    ------
+    NodeNotFound
+        If `source` is not in `G`.
+
+    NetworkXUnbounded
+        If the (di)graph contains a negative (di)cycle, the
+        algorithm raises an exception to indicate the presence of the
+        negative (di)cycle.  Note: any negative weight edge in an
+        undirected graph is a negative cycle.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(5, create_using=nx.DiGraph());
+    >>> pred, dist = nx.tarjan_bellman_ford(G, 0);
+    >>> sorted(pred.items());
+    [(0, None), (1, 0), (2, 1), (3, 2), (4, 3)];
+    >>> sorted(dist.items());
+    [(0, 0), (1, 1), (2, 2), (3, 3), (4, 4)];
+
+    >>> G = nx.cycle_graph(5, create_using=nx.DiGraph());
+    >>> G[1][2]["weight"] = -7
+    >>> nx.tarjan_bellman_ford(G, 0);
+    Traceback (most recent call last):
+        ...
+    graphx.exception.NetworkXUnbounded: Negative cycle detected.
+
+    Notes
+    -----
+    Edge weight attributes must be numerical.
+    Distances are calculated as sums of weighted edges traversed.
+
+    The dictionaries returned only have keys for nodes reachable from
+    the source.
+
+    In the case where the (di)graph is not connected, if a component
+    not containing the source contains a negative (di)cycle, it
+    will not be detected.
+
+    See Also
+    --------
+    goldberg_radzik
+    bellman_ford_predecessor_and_distance
+
+    References
+    ----------
+    .. [1] Tarjan, R. E. (1981). Shortest paths.
+       Technical report, AT&T Bell Laboratories.
+    .. [2] Cherkassky, B. V., Goldberg, A. V. and Radzik, T. (1996).
+       Shortest paths algorithms: Theory and experimental evaluation.
+       *Mathematical Programming*, 73(2), 129-174.
+    */
+    if (!G.contains(source)) {
+        throw nx.NodeNotFound(f"Node {source} is not found in the graph");
+    weight = _weight_function(G, weight);
+    nodes, dist, parent, cycle = _tarjan_bellman_ford(G, [source], weight);
+    if (cycle is not None) {
+        throw nx.NetworkXUnbounded("Negative cycle detected.");
+    pred = {};
+    d = {};
+    for (auto i, u : enumerate(nodes)) {
+        if (dist[i] < inf) {
+            pred[u] = nodes[parent[i]] if parent[i] >= 0 else None
+            d[u] = dist[i];
+    return pred, d
+}
+
+auto _tarjan_bellman_ford(G, sources, weight) -> void {
+    /** Label-correcting loop with subtree disassembly over array state.
+
+    Nodes are numbered by their position in ``list(G)``. All `sources` start
+    at distance 0, which is the same as a virtual root joined to each of
+    them by a zero-weight edge.
+
+    Returns
+    -------
+    nodes : list
+        The nodes of `G`, giving the numbering of the other lists.
+
+    dist : list
+        Distance of each node, `inf` for unreachable nodes.
+
+    parent : list
+        Number of the predecessor of each node on a shortest path,
+        -1 for the sources and unreachable nodes.
+
+    cycle : list or None
+        The nodes of a negative cycle with the first node repeated at the
+        end, or None. If a cycle is returned, `dist` and `parent` are
+        only partially computed.
+    */
+    nodes = list(G);
+    index = {u: i for i, u in enumerate(nodes)};
+    n = nodes.size();
+    // Evaluate the weights once; the relaxations only touch these lists.
+    offsets = [0];
+    heads = [];
+    weights = [];
+    for (auto u : nodes) {
+        for (auto v, e : G._adj[u].items()) {
+            heads.append(index[v]);
+            weights.append(weight(u, v, e));
+        offsets.append(heads.size());
+
+    dist = [inf] * n;
+    parent = [-1] * n;
+    // Children lists may hold stale entries; c is a child of u only while
+    // parent[c] == u.
+    children = [[] for _ in range(n)];
+    in_q = [false] * n;
+    mark = [0] * n;
+    stamp = 0;
+    q = deque();
+    // Sum and number of the labels in the queue for Large Label Last, and
+    // the number of nodes postponed since a node was last scanned.
+    total = 0;
+    count = 0;
+    postponed = 0;
+    for (auto s : sources) {
+        i = index[s];
+        if (!in_q[i]) {
+            dist[i] = 0;
+            in_q[i] = true;
+            q.append(i);
+            count += 1;
+
+    while (q) {
+        u = q.popleft();
+        if (!in_q[u]) {
+            // Removed from the queue by a disassembly.
+            continue;
+        if (postponed < count and dist[u] * count > total) {
+            // Large Label Last: postpone nodes above the average label. With
+            // floating point weights the running total may drift below every
+            // label, so after a full rotation the head is scanned anyway.
+            postponed += 1;
+            q.append(u);
+            continue;
+        postponed = 0;
+        in_q[u] = false;
+        total -= dist[u];
+        count -= 1;
+        dist_u = dist[u];
+        for (auto k : range(offsets[u], offsets[u + 1])) {
+            v = heads[k];
+            dist_v = dist_u + weights[k];
+            if (dist_v >= dist[v]) {
+                continue;
+            // Collect the subtree rooted at v. If it contains u, the edge
+            // (u, v) closes a cycle in the tree, which has negative weight.
+            stamp += 1;
+            mark[v] = stamp;
+            subtree = [v];
+            for (auto x : subtree) {
+                for (auto c : children[x]) {
+                    if (parent[c] == x and mark[c] != stamp) {
+                        mark[c] = stamp;
+                        subtree.append(c);
+            if (mark[u] == stamp) {
+                cycle = [u];
+                x = u
+                while (x != v) {
+                    x = parent[x];
+                    cycle.append(x);
+                cycle.reverse();
+                cycle.append(v);
+                return nodes, dist, parent, [nodes[x] for x in cycle];
+            for (auto x : subtree) {
+                children[x] = [];
+                if (x != v) {
+                    parent[x] = -1;
+                    if (in_q[x]) {
+                        in_q[x] = false;
+                        total -= dist[x];
+                        count -= 1;
+            if (in_q[v]) {
+                total += dist_v - dist[v];
+            } else {
+                in_q[v] = true;
+                total += dist_v;
+                count += 1;
+                // Small Label First: jump the queue if below its head.
+                if (q and dist_v < dist[q[0]]) {
+                    q.appendleft(v);
+                } else {
+                    q.append(v);
+            dist[v] = dist_v
+            parent[v] = u
+            children[u].append(v);
+    return nodes, dist, parent, None
+}
+
 auto negative_edge_cycle(G, weight="weight", heuristic=true) -> void {
     /** Returns true if there exists a negative edge cycle anywhere in G.
 
@@ -2089,9 +2484,10 @@ auto negative_edge_cycle(G, weight="weight", heuristic=true) -> void {
         return a number.
 
     heuristic : bool
-        Determines whether to use a heuristic to early detect negative
-        cycles at a negligible cost. In case of graphs with a negative cycle,
-        the performance of detection increases by at least an order of magnitude.
+        Determines whether to use subtree disassembly (see
+        :func:`tarjan_bellman_ford`) to early detect negative cycles at a
+        negligible cost. In case of graphs with a negative cycle, the
+        performance of detection increases by at least an order of magnitude.
 
     Returns
     -------
@@ -2112,11 +2508,15 @@ auto negative_edge_cycle(G, weight="weight", heuristic=true) -> void {
     Edge weight attributes must be numerical.
     Distances are calculated as sums of weighted edges traversed.
 
-    This algorithm uses bellman_ford_predecessor_and_distance() but finds
-    negative cycles on any component by first adding a new node connected to
-    every node, and starting bellman_ford_predecessor_and_distance on that
-    node.  It then removes that extra node.
+    This algorithm finds negative cycles on any component by starting the
+    search from every node at once, as if from a new node connected to every
+    node. With `heuristic` false, it uses bellman_ford_predecessor_and_distance()
+    from such a node, which is temporarily added to `G`.
     */
+    if (heuristic) {
+        weight = _weight_function(G, weight);
+        return _tarjan_bellman_ford(G, G, weight)[3] is not None
+
     // find unused node to use temporarily
     newnode = -1
     while (newnode in G) {
@@ -2138,9 +2538,10 @@ auto negative_edge_cycle(G, weight="weight", heuristic=true) -> void {
 auto find_negative_cycle(G, source, weight="weight") -> void {
     /** Returns a cycle with negative total weight if it exists.
 
-    Bellman-Ford is used to find shortest_paths. That algorithm
-    stops if there exists a negative cycle. This algorithm
-    picks up from there and returns the found negative cycle.
+    The label-correcting search of :func:`tarjan_bellman_ford` is used to
+    find shortest paths. Its subtree disassembly detects a negative cycle
+    as soon as a relaxation closes one in the shortest path tree, and
+    that cycle is returned.
 
     The cycle consists of a list of nodes in the cycle order. The last
     node equals the first to make it a cycle.
@@ -2175,7 +2576,7 @@ auto find_negative_cycle(G, source, weight="weight") -> void {
     >>> G = nx.DiGraph();
     >>> G.add_weighted_edges_from([(0, 1, 2), (1, 2, 2), (2, 0, 1), (1, 4, 2), (4, 0, -5)]);
     >>> nx.find_negative_cycle(G, 0);
-    [4, 0, 1, 4];
+    [0, 1, 4, 0];
 
     Returns
     -------
@@ -2188,46 +2589,16 @@ auto find_negative_cycle(G, source, weight="weight") -> void {
     NetworkXError
         If no negative cycle is found.
     */
+    if (!G.contains(source)) {
+        throw nx.NodeNotFound(f"Node {source} is not found in the graph");
     weight = _weight_function(G, weight);
-    pred = {source: []};
-
-    v = _inner_bellman_ford(G, [source], weight, pred=pred);
-    if (v is None) {
+    cycle = _tarjan_bellman_ford(G, [source], weight)[3];
+    if (cycle is None) {
         throw nx.NetworkXError("No negative cycles detected.");
-
-    // negative cycle detected... find it
-    neg_cycle = [];
-    stack = [(v, list(pred[v]))];
-    seen = {v};
-    while (stack) {
-        node, preds = stack[-1];
-        if (preds.contains(v)) {
-            // found the cycle
-            neg_cycle.extend([node, v]);
-            neg_cycle = list(reversed(neg_cycle));
-            return neg_cycle
-
-        if (preds) {
-            nbr = preds.pop();
-            if (!seen.contains(nbr)) {
-                stack.append((nbr, list(pred[nbr])));
-                neg_cycle.append(node);
-                seen.add(nbr);
-        } else {
-            stack.pop();
-            if (neg_cycle) {
-                neg_cycle.pop();
-            } else {
-                if (G.contains(v)[v] and weight(G, v, v) < 0) {
-                    return [v, v];
-                // should not reach here
-                throw nx.NetworkXError("Negative cycle is detected but not found");
-    // should not get here...
-    msg = "negative cycle detected but not identified"
-    throw nx.NetworkXUnbounded(msg);
+    return cycle
 }
 
-auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
+auto bidirectional_dijkstra(G, source, target, weight="weight", heuristic=None) -> void {
     /** Dijkstra's algorithm for shortest paths using bidirectional search.
 
     Parameters
@@ -2253,6 +2624,13 @@ auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
         dictionary of edge attributes for that edge. The function must
         return a number.
 
+    heuristic : function, optional (default=None);
+        A function ``heuristic(u, v)`` returning a lower bound on the
+        distance from `u` to `v`, such as an :class:`ALTIndex` built for
+        the same `weight`. If given, both searches are guided towards each
+        other by it. The heuristic must be consistent (monotone), which is
+        stronger than the admissibility required by :func:`astar_path`.
+
     Returns
     -------
     length, path : number and list
@@ -2295,6 +2673,10 @@ auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
     this radius. Volume of the first sphere is `\pi*r*r` while the
     others are `2*\pi*r/2*r/2`, making up half the volume.
 
+    With a `heuristic` both searches use the symmetric potential
+    ``(heuristic(v, target) - heuristic(source, v)) / 2`` so that they
+    mostly expand nodes close to the shortest path [1]_.
+
     This algorithm is not guaranteed to work if edge weights
     are negative or are floating point numbers
     (overflows and roundoff errors can cause problems).
@@ -2303,6 +2685,14 @@ auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
     --------
     shortest_path
     shortest_path_length
+    ALTIndex
+
+    References
+    ----------
+    .. [1] Goldberg, A. V. and Harrelson, C. (2005).
+       Computing the shortest path: A* search meets graph theory.
+       *Proceedings of the 16th ACM-SIAM Symposium on Discrete Algorithms*,
+       156-165.
     */
     if (!G.contains(source) or !G.contains(target)) {
         msg = f"Either source {source} or target {target} is not in G"
@@ -2312,6 +2702,8 @@ auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
         return (0, [source]);
 
     weight = _weight_function(G, weight);
+    if (heuristic is not None) {
+        return _bidirectional_astar(G, source, target, weight, heuristic);
     push = heappush
     pop = heappop
     // Init:  [Forward, Backward];
@@ -2374,6 +2766,80 @@ auto bidirectional_dijkstra(G, source, target, weight="weight") -> void {
     throw nx.NetworkXNoPath(f"No path between {source} and {target}.");
 
 
+auto _bidirectional_astar(G, source, target, weight, heuristic) -> void {
+    /** Bidirectional A* search with symmetric potentials.
+
+    The forward search is keyed by ``d(source, v) + p(v)`` and the backward
+    search by ``d(v, target) - p(v)`` with
+    ``p(v) = (heuristic(v, target) - heuristic(source, v)) / 2``. This is
+    bidirectional Dijkstra on the graph with reduced weights
+    ``w(u, v) - p(u) + p(v)``, which are nonnegative for consistent
+    heuristics, so the search can stop once the two smallest keys sum to
+    at least the best path length found.
+    */
+    potentials = {};
+
+    auto potential(v) -> void {
+        p = potentials.get(v);
+        if (p is None) {
+            p = (heuristic(v, target) - heuristic(source, v)) / 2
+            potentials[v] = p
+        return p
+
+    push = heappush
+    pop = heappop
+    if (G.is_directed()) {
+        neighs = [G._succ, G._pred];
+    } else {
+        neighs = [G._adj, G._adj];
+    sign = [1, -1];
+    dists = [{}, {}];
+    seen = [{source: 0}, {target: 0}];
+    preds = [{source: None}, {target: None}];
+    c = count();
+    fringe = [ [(potential(source), next(c), source)], [(-potential(target), next(c), target)]];
+    bestdist = None
+    meet = None
+    dir = 1;
+    while (fringe[0] and fringe[1]) {
+        if (bestdist is not None and fringe[0][0][0] + fringe[1][0][0] >= bestdist) {
+            break;
+        dir = 1 - dir
+        _, _, v = pop(fringe[dir]);
+        if (dists[dir].contains(v)) {
+            continue;
+        dist = dists[dir][v] = seen[dir][v];
+        for (auto w, d : neighs[dir][v].items()) {
+            cost = weight(v, w, d) if dir == 0 else weight(w, v, d);
+            if (cost is None or dists[dir].contains(w)) {
+                continue;
+            vwLength = dist + cost
+            if (!seen[dir].contains(w) or vwLength < seen[dir][w]) {
+                seen[dir][w] = vwLength
+                preds[dir][w] = v
+                push(fringe[dir], (vwLength + sign[dir] * potential(w), next(c), w));
+                if (seen[1 - dir].contains(w)) {
+                    totaldist = vwLength + seen[1 - dir][w];
+                    if (bestdist is None or totaldist < bestdist) {
+                        bestdist = totaldist
+                        meet = w
+
+    if (meet is None) {
+        throw nx.NetworkXNoPath(f"No path between {source} and {target}.");
+    path = [];
+    node = meet
+    while (node is not None) {
+        path.append(node);
+        node = preds[0][node];
+    path.reverse();
+    node = preds[1][meet];
+    while (node is not None) {
+        path.append(node);
+        node = preds[1][node];
+    return (bestdist, path);
+}
+
+
 auto johnson(G, weight="weight") -> void {
     /** Uses Johnson's Algorithm to compute shortest paths.
 
@@ -2422,7 +2888,8 @@ auto johnson(G, weight="weight") -> void {
     Johnson's algorithm is suitable even for graphs with negative weights. It
     works by using the Bellman–Ford algorithm to compute a transformation of
     the input graph that removes all negative weights, allowing Dijkstra's
-    algorithm to be used on the transformed graph.
+    algorithm to be used on the transformed graph. The transformation is
+    computed with the subtree disassembly of :func:`tarjan_bellman_ford`.
 
     The time complexity of this algorithm is $O(n^2 \log n + n m)$,
     where $n$ is the number of nodes and $m$ the number of edges in the
@@ -2444,12 +2911,14 @@ auto johnson(G, weight="weight") -> void {
     if (!nx.is_weighted(G, weight=weight)) {
         throw nx.NetworkXError("Graph is not weighted.");
 
-    dist = {v: 0 for v in G};
-    pred = {v: [] for v in G};
     weight = _weight_function(G, weight);
 
-    // Calculate distance of shortest paths
-    dist_bellman = _bellman_ford(G, list(G), weight, pred=pred, dist=dist);
+    // Calculate distance of shortest paths from a virtual node joined to
+    // every node.
+    nodes, dist, _, cycle = _tarjan_bellman_ford(G, G, weight);
+    if (cycle is not None) {
+        throw nx.NetworkXUnbounded("Negative cycle detected.");
+    dist_bellman = dict(zip(nodes, dist));
 
     // Update the weight function to take into account the Bellman--Ford
     // relaxation distances.
@@ -1,5 +1,7 @@
-// from heapq import heappop, heappush
+// from collections import deque
+// from heapq import heapify, heappop, heappush
 // from itertools import count
+// from math import inf
 
 // import graphx as nx
 #include <graphx/algorithms.shortest_paths.weighted.hpp>  // import _weight_function
@@ -9,6 +11,7 @@ __all__ = [
     "all_simple_paths",
     "is_simple_path",
     "shortest_simple_paths",
+    "shortest_walks",
     "all_simple_edge_paths",
 ];
 
@@ -206,10 +209,11 @@ auto all_simple_paths(G, source, target, cutoff=None) -> void {
     number of simple paths in a graph can be very large, e.g. $O(n!)$ in
     the complete graph of order $n$.
 
-    This function does not check that a path exists between `source` and
-    `target`. For large graphs, this may result in very long runtimes.
-    Consider using `has_path` to check that a path exists between `source` and
-    `target` before calling this function on large graphs.
+    Before the search, the fewest number of edges from every node to a
+    target is computed with a breadth-first search towards `source`. Branches
+    that cannot reach a target within `cutoff` are skipped, including those
+    that cannot reach a target at all. The subtrees of the search below
+    different neighbors of `source` are independent of each other.
 
     References
     ----------
@@ -236,17 +240,41 @@ auto all_simple_paths(G, source, target, cutoff=None) -> void {
         cutoff = G.size() - 1
     if (cutoff < 1) {
         return _empty_generator();
+    onward = _hops_to_targets(G, targets);
     if (G.is_multigraph()) {
-        return _all_simple_paths_multigraph(G, source, targets, cutoff);
+        return _all_simple_paths_multigraph(G, source, targets, cutoff, onward);
     } else {
-        return _all_simple_paths_graph(G, source, targets, cutoff);
+        return _all_simple_paths_graph(G, source, targets, cutoff, onward);
+}
+
+auto _hops_to_targets(G, targets) -> void {
+    /** Returns a dict giving for each node the fewest edges on a walk of at
+    least one edge from it to a node in `targets`, or `inf` if there is none.
+
+    The value is a lower bound on the length of any simple path leaving the
+    node towards a target, so paths can be cut as soon as it exceeds the
+    remaining depth. Targets that are not in `G` are ignored.
+    */
+    G_pred = G._pred if G.is_directed() else G._adj
+    hops = {t: 0 for t in targets if t in G_pred};
+    queue = deque(hops);
+    while (queue) {
+        v = queue.popleft();
+        for (auto u : G_pred[v]) {
+            if (!hops.contains(u)) {
+                hops[u] = hops[v] + 1;
+                queue.append(u);
+    return {
+        v: min((hops[w] + 1 for w in nbrs if w in hops), default=inf)
+        for v, nbrs in G._adj.items()
+    };
 }
 
 auto _empty_generator() -> void {
     yield from ();
 }
 
-auto _all_simple_paths_graph(G, source, targets, cutoff) -> void {
+auto _all_simple_paths_graph(G, source, targets, cutoff, onward) -> void {
     visited = dict.fromkeys([source]);
     stack = [iter(G[source])];
     while (stack) {
@@ -260,6 +288,9 @@ auto _all_simple_paths_graph(G, source, targets, cutoff) -> void {
                 continue;
             if (targets.contains(child)) {
                 yield list(visited) + [child];
+            // Skip children from which no further target is in reach.
+            if (visited.size() + onward[child] > cutoff) {
+                continue;
             visited[child] = None
             if (targets - set(visited.keys())) {  // expand stack until find all targets
                 stack.append(iter(G[child]));
@@ -272,7 +303,7 @@ auto _all_simple_paths_graph(G, source, targets, cutoff) -> void {
             visited.popitem();
 }
 
-auto _all_simple_paths_multigraph(G, source, targets, cutoff) -> void {
+auto _all_simple_paths_multigraph(G, source, targets, cutoff, onward) -> void {
     visited = dict.fromkeys([source]);
     stack = [(v for u, v in G.edges(source))];
     while (stack) {
@@ -286,6 +317,8 @@ auto _all_simple_paths_multigraph(G, source, targets, cutoff) -> void {
                 continue;
             if (targets.contains(child)) {
                 yield list(visited) + [child];
+            if (visited.size() + onward[child] > cutoff) {
+                continue;
             visited[child] = None
             if (targets - set(visited.keys())) {
                 stack.append((v for u, v in G.edges(child)));
@@ -386,15 +419,16 @@ auto all_simple_edge_paths(G, source, target, cutoff=None) -> void {
         cutoff = G.size() - 1
     if (cutoff < 1) {
         return [];
+    onward = _hops_to_targets(G, targets);
     if (G.is_multigraph()) {
-        for (auto simp_path : _all_simple_edge_paths_multigraph(G, source, targets, cutoff)) {
+        for (auto simp_path : _all_simple_edge_paths_multigraph(G, source, targets, cutoff, onward)) {
             yield simp_path
     } else {
-        for (auto simp_path : _all_simple_paths_graph(G, source, targets, cutoff)) {
+        for (auto simp_path : _all_simple_paths_graph(G, source, targets, cutoff, onward)) {
             yield list(zip(simp_path[:-1], simp_path[1:]));
 }
 
-auto _all_simple_edge_paths_multigraph(G, source, targets, cutoff) -> void {
+auto _all_simple_edge_paths_multigraph(G, source, targets, cutoff, onward) -> void {
     if (!cutoff or cutoff < 1) {
         return [];
     visited = [source];
@@ -410,6 +444,8 @@ auto _all_simple_edge_paths_multigraph(G, source, targets, cutoff) -> void {
             if (child[1] in targets) {
                 yield visited[1:] + [child];
             } else if (![v[0].contains(child[1]) for (auto v : visited[1) {]]) {
+                if (visited.size() + onward[child[1]] > cutoff) {
+                    continue;
                 visited.append(child);
                 stack.append(iter(G.edges(child[1], keys=true)));
         } else {  // visited.size() == cutoff:
@@ -495,17 +531,28 @@ auto shortest_simple_paths(G, source, target, weight=None) -> void {
     This procedure is based on algorithm by Jin Y. Yen [1]_.  Finding
     the first $K$ paths requires $O(KN^3)$ operations.
 
+    Each path only spawns spur searches from its deviation node onwards,
+    as proposed by Lawler [2]_. In the weighted case a shortest path tree
+    towards `target` is computed once, and a spur search is skipped when
+    the tree path from the spur node avoids the removed nodes and edges.
+    The spur searches of one path are independent of each other.
+
     See Also
     --------
     all_shortest_paths
     shortest_path
     all_simple_paths
+    shortest_walks
 
     References
     ----------
     .. [1] Jin Y. Yen, "Finding the K Shortest Loopless Paths in a
        Network", Management Science, Vol. 17, No. 11, Theory Series
        (Jul., 1971), pp. 712-716.
+    .. [2] Eugene L. Lawler, "A Procedure for Computing the K Best Solutions
+       to Discrete Optimization Problems and Its Application to the Shortest
+       Path Problem", Management Science, Vol. 18, No. 7 (Mar., 1972),
+       pp. 401-405.
 
     */
     if (!G.contains(source)) {
@@ -515,56 +562,73 @@ auto shortest_simple_paths(G, source, target, weight=None) -> void {
         throw nx.NodeNotFound(f"target node !graph".contains({target}));
 
     if (weight is None) {
-        length_func = len
+        wt = None
         shortest_path_func = _bidirectional_shortest_path
     } else {
         wt = _weight_function(G, weight);
-
-        auto length_func(path) -> void {
-            return sum(
-                wt(u, v, G.get_edge_data(u, v)) for (auto (u, v) : zip(path, path[1) {]);
-            );
-
         shortest_path_func = _bidirectional_dijkstra
+        // Shortest path tree towards the target, shared by all spur searches.
+        R = G.reverse(copy=false) if G.is_directed() else G
+        tree_pred, to_target = nx.dijkstra_predecessor_and_distance(
+            R, target, weight=lambda u, v, d: wt(v, u, d)
+        );
+
+    auto spur_path(node, ignore_nodes, ignore_edges) -> void {
+        /** Returns the length and a shortest path from `node` to `target`
+        avoiding `ignore_nodes` and `ignore_edges`.
+        */
+        if (wt is not None) {
+            if (!to_target.contains(node)) {
+                throw nx.NetworkXNoPath(f"No path between {node} and {target}.");
+            // The tree path cannot be beaten, so use it if it is available.
+            path = [node];
+            while (path[-1] != target) {
+                nbr = tree_pred[path[-1]][0];
+                if (ignore_nodes.contains(nbr) or ignore_edges.contains((path[-1], nbr))) {
+                    break;
+                path.append(nbr);
+            if (path[-1] == target) {
+                return to_target[node], path
+        return shortest_path_func(
+            G,
+            node,
+            target,
+            ignore_nodes=ignore_nodes,
+            ignore_edges=ignore_edges,
+            weight=weight,
+        );
 
-    listA = list();
     listB = PathBuffer();
-    prev_path = None
-    while (true) {
-        if (!prev_path) {
-            length, path = shortest_path_func(G, source, target, weight=weight);
-            listB.push(length, path);
-        } else {
-            ignore_nodes = set();
-            ignore_edges = set();
-            for (auto i : range(1, prev_path.size())) {
-                root = prev_path[:i];
-                root_length = length_func(root);
-                for (auto path : listA) {
-                    if (path[) {i] == root:
-                        ignore_edges.add((path[i - 1], path[i]));
+    // Prefix tree of the paths yielded so far. The keys of the dict reached
+    // by following a root are the nodes that follow that root in them.
+    prefixes = {};
+    length, path = shortest_path_func(G, source, target, weight=weight);
+    listB.push(length, path);
+    while (listB) {
+        path, deviation = listB.pop();
+        yield path
+        node = prefixes
+        for (auto v : path) {
+            node = node.setdefault(v, {});
+
+        ignore_nodes = set();
+        root_length = 0;
+        node = prefixes[source];
+        for (auto i : range(1, path.size())) {
+            u = path[i - 1];
+            // Spur nodes before the deviation node were already used for
+            // the path this one deviates from, with the same results.
+            if (i - 1 >= deviation) {
+                ignore_edges = {(u, v) for v in node};
                 try {
-                    length, spur = shortest_path_func(
-                        G,
-                        root[-1],
-                        target,
-                        ignore_nodes=ignore_nodes,
-                        ignore_edges=ignore_edges,
-                        weight=weight,
-                    );
-                    path = root[:-1] + spur
-                    listB.push(root_length + length, path);
+                    length, spur = spur_path(u, ignore_nodes, ignore_edges);
+                    listB.push(root_length + length, path[: i - 1] + spur, i - 1);
                 } catch (nx.NetworkXNoPath) {
                     // pass;
-                ignore_nodes.add(root[-1]);
-
-        if (listB) {
-            path = listB.pop();
-            yield path
-            listA.append(path);
-            prev_path = path
-        } else {
-            break;
+            ignore_nodes.add(u);
+            v = path[i];
+            root_length += 1 if wt is None else wt(u, v, G.get_edge_data(u, v));
+            node = node[v];
 }
 
 class PathBuffer {
@@ -576,19 +640,173 @@ class PathBuffer {
     auto size() const -> size_t {
         return this->sortedpaths.size();
 
-    auto push(cost, path) const -> void {
+    auto push(cost, path, deviation=0) const -> void {
         hashable_path = tuple(path);
         if (!this->paths.contains(hashable_path)) {
-            heappush(this->sortedpaths, (cost, next(this->counter), path));
+            heappush(this->sortedpaths, (cost, next(this->counter), path, deviation));
             this->paths.add(hashable_path);
 
     auto pop() const -> void {
-        (cost, num, path) = heappop(this->sortedpaths);
+        (cost, num, path, deviation) = heappop(this->sortedpaths);
         hashable_path = tuple(path);
         this->paths.remove(hashable_path);
-        return path
+        return path, deviation
 };
 
+// @not_implemented_for("multigraph");
+auto shortest_walks(G, source, target, weight=None) -> void {
+    /** Generate all walks in the graph G from source to target,
+       starting from shortest ones.
+
+    A walk may visit nodes and edges more than once. If the graph has a
+    cycle reachable from `source` from which `target` can be reached, there
+    are infinitely many walks and the generator never stops.
+
+    No negative weights are allowed.
+
+    Parameters
+    ----------
+    G : GraphX graph
+
+    source : node
+       Starting node for walk
+
+    target : node
+       Ending node for walk
+
+    weight : string or function
+        If it is a string, it is the name of the edge attribute to be
+        used as a weight.
+
+        If it is a function, the weight of an edge is the value returned
+        by the function. The function must accept exactly three positional
+        arguments: the two endpoints of an edge and the dictionary of edge
+        attributes for that edge. The function must return a number or
+        None to indicate a hidden edge.
+
+        If None all edges are considered to have unit weight. Default
+        value None.
+
+    Returns
+    -------
+    walk_generator: generator
+       A generator that produces lists of nodes, in order from shortest
+       to longest walk.
+
+    Raises
+    ------
+    NetworkXNoPath
+       If no path exists between source and target.
+
+    NodeNotFound
+       If source or target nodes are not in the input graph.
+
+    NetworkXNotImplemented
+       If the input graph is a Multi[Di]Graph.
+
+    Examples
+    --------
+    >>> from itertools import islice
+    >>> G = nx.cycle_graph(4, create_using=nx.DiGraph());
+    >>> G.add_edge(0, 2);
+    >>> list(islice(nx.shortest_walks(G, 0, 2), 3));
+    [ [0, 2], [0, 1, 2], [0, 2, 3, 0, 2]];
+
+    Notes
+    -----
+    This is the Recursive Enumeration Algorithm of Jiménez and Marzal [1]_.
+    Like Eppstein's algorithm [2]_, it represents every walk implicitly by
+    the walk it extends and its last edge. After one Dijkstra search from
+    `source`, each further walk costs $O(L \log d)$ time, where $L$ is the
+    number of edges of the previous walk and $d$ is the maximum in-degree.
+
+    See Also
+    --------
+    shortest_simple_paths
+
+    References
+    ----------
+    .. [1] Víctor M. Jiménez and Andrés Marzal, "Computing the K Shortest
+       Paths: A New Algorithm and an Experimental Comparison", Algorithm
+       Engineering (WAE 1999), LNCS 1668, pp. 15-29.
+    .. [2] David Eppstein, "Finding the k Shortest Paths", SIAM Journal on
+       Computing, Vol. 28, No. 2 (1998), pp. 652-673.
+    */
+    if (!G.contains(source)) {
+        throw nx.NodeNotFound(f"source node !graph".contains({source}));
+
+    if (!G.contains(target)) {
+        throw nx.NodeNotFound(f"target node !graph".contains({target}));
+
+    wt = (lambda u, v, d: 1) if weight is None else _weight_function(G, weight);
+    G_pred = G._pred if G.is_directed() else G._adj
+
+    pred, dist = nx.dijkstra_predecessor_and_distance(G, source, weight=wt);
+    if (!dist.contains(target)) {
+        throw nx.NetworkXNoPath(f"No path between {source} and {target}.");
+    // walks[v][k] is (length, u, j) if the k-th shortest walk to v is the
+    // j-th shortest walk to u followed by the edge (u, v).
+    walks = {v: [(d, pred[v][0] if pred[v] else None, 0)] for v, d in dist.items()};
+    // Zero-weight edges back to the source add predecessors of the source,
+    // but its shortest walk is always the empty one.
+    walks[source] = [(0, None, 0)];
+    // Heaps of the candidates for the next walk to each node, created on
+    // first use, and the nodes without further walks.
+    candidates = {};
+    exhausted = set();
+    c = count();
+
+    auto first_candidates(v) -> void {
+        heap = [];
+        first = walks[v][0][1];
+        for (auto u, e : G_pred[v].items()) {
+            if (u == first or !walks.contains(u)) {
+                continue;
+            w = wt(u, v, e);
+            if (w is not None) {
+                heap.append((walks[u][0][0] + w, next(c), u, 0));
+        heapify(heap);
+        return heap
+
+    k = 0;
+    while (true) {
+        walk = [target];
+        _, u, j = walks[target][k];
+        while (u is not None) {
+            walk.append(u);
+            _, u, j = walks[u][j];
+        walk.reverse();
+        yield walk
+
+        // Compute the next walk to target, first computing the next walks
+        // to the nodes it may extend.
+        k += 1;
+        stack = [(target, k)];
+        while (stack) {
+            v, i = stack[-1];
+            if (walks[v].size() > i or exhausted.contains(v)) {
+                stack.pop();
+                continue;
+            _, u, j = walks[v][i - 1];
+            if (u is not None and walks[u].size() <= j + 1 and !exhausted.contains(u)) {
+                stack.append((u, j + 1));
+                continue;
+            stack.pop();
+            if (!candidates.contains(v)) {
+                candidates[v] = first_candidates(v);
+            heap = candidates[v];
+            if (u is not None and walks[u].size() > j + 1) {
+                length = walks[u][j + 1][0] + wt(u, v, G_pred[v][u]);
+                heappush(heap, (length, next(c), u, j + 1));
+            if (heap) {
+                length, _, u, j = heappop(heap);
+                walks[v].append((length, u, j));
+            } else {
+                exhausted.add(v);
+        if (walks[target].size() <= k) {
+            return;
+}
+
 auto _bidirectional_shortest_path(
     G, source, target, ignore_nodes=None, ignore_edges=None, weight=None
 ) -> void {
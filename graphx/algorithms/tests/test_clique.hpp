@@ -229,6 +229,21 @@ class TestCliques {
         H2 = nx.make_max_clique_graph(G);
         assert H1.adj == H2.adj
 
+    auto test_find_cliques_random() const -> void {
+        for (auto seed : range(5)) {
+            G = nx.gnp_random_graph(40, 0.3, seed=seed);
+            G.add_edges_from([(0, 0), (7, 7)]);
+            cl = list(nx.find_cliques(G));
+            rcl = list(nx.find_cliques_recursive(G));
+            assert(cl.size() == set(map(frozenset, cl)).size());
+            assert(sorted(map(sorted, cl)) == sorted(map(sorted, rcl)));
+
+    auto test_find_cliques_isolated_nodes() const -> void {
+        G = nx.Graph([(0, 1), (2, 2)]);
+        G.add_node(3);
+        assert(sorted(map(sorted, nx.find_cliques(G))) == [ [0, 1], [2], [3]]);
+        assert(list(nx.find_cliques(G, [3])) == [ [3]]);
+
     auto test_directed() const -> void {
         with pytest.raises(nx.NetworkXNotImplemented):
             next(nx.find_cliques(nx.DiGraph()));
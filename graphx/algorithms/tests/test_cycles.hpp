@@ -87,6 +87,30 @@ class TestCycles {
         G = nx.DiGraph();
         assert(list(nx.simple_cycles(G)) == []);
 
+    auto test_simple_cycles_length_bound() const -> void {
+        edges = [(0, 0), (0, 1), (0, 2), (1, 2), (2, 0), (2, 1), (2, 2)];
+        G = nx.DiGraph(edges);
+        assert(list(nx.simple_cycles(G, length_bound=0)) == []);
+        cc = sorted(nx.simple_cycles(G, length_bound=1));
+        assert(cc == [ [0], [2]]);
+        cc = sorted(nx.simple_cycles(G, length_bound=2));
+        ca = [ [0], [0, 2], [1, 2], [2]];
+        assert(cc.size() == ca.size());
+        for (auto c : cc) {
+            assert(any(this->is_cyclic_permutation(c, rc) for rc in ca));
+        pytest.raises(ValueError, list, nx.simple_cycles(G, length_bound=-1));
+
+    auto test_simple_cycles_length_bound_matches_filter() const -> void {
+        for (auto seed : range(5)) {
+            G = nx.gnp_random_graph(10, 0.3, seed=seed, directed=true);
+            all_cycles = list(nx.simple_cycles(G));
+            for (auto k : range(1, 6)) {
+                expected = [c for c in all_cycles if c.size() <= k];
+                cc = list(nx.simple_cycles(G, length_bound=k));
+                assert(all(c.size() <= k for c in cc));
+                assert(cc.size() == expected.size());
+                assert({frozenset(c) for c in cc} == {frozenset(c) for c in expected});
+
     auto test_complete_directed_graph() const -> void {
         // see table 2 in Johnson's paper
         ncircuits = [1, 5, 20, 84, 409, 2365, 16064];
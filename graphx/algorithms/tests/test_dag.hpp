@@ -1,5 +1,6 @@
 // from collections import deque
 // from itertools import combinations, permutations
+// import random
 
 // import pytest
 
@@ -727,3 +728,82 @@ auto test_compute_v_structures() -> void {
     G = nx.DiGraph(edges);
     v_structs = set(nx.compute_v_structures(G));
     assert(v_structs.size() == 2);
+}
+
+class TestIncrementalTopologicalOrder {
+    // @staticmethod
+    auto _assert_valid(order) -> void {
+        nodes = list(order);
+        assert(set(nodes) == set(order.G));
+        pos = {n: i for i, n in enumerate(nodes)};
+        assert(all(pos[u] < pos[v] for u, v in order.G.edges));
+
+    auto test_init_from_dag() const -> void {
+        G = nx.DiGraph([(1, 2), (2, 3), (1, 3), (4, 3)]);
+        order = nx.IncrementalTopologicalOrder(G);
+        assert order.G is G
+        assert(order.size() == 4);
+        this->_assert_valid(order);
+
+    auto test_init_errors() const -> void {
+        pytest.raises(nx.NetworkXError, nx.IncrementalTopologicalOrder, nx.Graph());
+        G = nx.cycle_graph(3, create_using=nx.DiGraph);
+        pytest.raises(nx.NetworkXUnfeasible, nx.IncrementalTopologicalOrder, G);
+
+    auto test_reorder_on_back_edge() const -> void {
+        order = nx.IncrementalTopologicalOrder();
+        for (auto n : range(6)) {
+            order.add_node(n);
+        order.add_edges_from([(4, 5), (0, 1), (5, 0), (3, 4)]);
+        this->_assert_valid(order);
+        assert(list(order) == [3, 4, 2, 5, 0, 1]);
+
+    auto test_reject_cycle() const -> void {
+        order = nx.IncrementalTopologicalOrder(nx.path_graph(5, create_using=nx.DiGraph));
+        assert(order.would_create_cycle(4, 0));
+        assert(order.would_create_cycle(2, 2));
+        assert(!order.would_create_cycle(0, 4));
+        assert(!order.would_create_cycle(4, "new"));
+        before = list(order);
+        with pytest.raises(nx.NetworkXUnfeasible):
+            order.add_edge(3, 1);
+        with pytest.raises(nx.NetworkXUnfeasible):
+            order.add_edge(1, 1);
+        assert(!order.G.has_edge(3, 1));
+        assert(list(order) == before);
+
+    auto test_random_insertions() const -> void {
+        // Cross check against a full cycle test after every insertion.
+        rng = random.Random(42);
+        order = nx.IncrementalTopologicalOrder();
+        for (auto _ : range(400)) {
+            u, v = rng.randrange(40), rng.randrange(40);
+            H = order.G.copy();
+            H.add_edge(u, v);
+            expected = !nx.is_directed_acyclic_graph(H);
+            assert(order.would_create_cycle(u, v) == expected);
+            if (expected) {
+                pytest.raises(nx.NetworkXUnfeasible, order.add_edge, u, v);
+            } else {
+                order.add_edge(u, v);
+            this->_assert_valid(order);
+
+    auto test_removals() const -> void {
+        order = nx.IncrementalTopologicalOrder();
+        order.add_edges_from([(0, 1), (1, 2)], weight=3);
+        assert(order.G[0][1]["weight"] == 3);
+        order.remove_edge(1, 2);
+        order.add_edge(2, 0);
+        this->_assert_valid(order);
+        order.remove_node(0);
+        assert(!order.contains(0));
+        assert(!order.would_create_cycle(1, 2));
+        this->_assert_valid(order);
+
+    auto test_add_edges_from_data() const -> void {
+        // Edge data wins over the shared attributes, as in Graph.add_edges_from.
+        order = nx.IncrementalTopologicalOrder();
+        order.add_edges_from([(1, 2, {"weight": 3}), (2, 3)], weight=1);
+        assert(order.G[1][2]["weight"] == 3);
+        assert(order.G[2][3]["weight"] == 1);
+}
@@ -655,3 +655,87 @@ auto test_digest_size_subgraph_hash() -> void {
 
         assert(hexdigest_sizes_correct(digest_size16_hashes, 16));
         assert(hexdigest_sizes_correct(digest_size32_hashes, 32));
+}
+
+// Unit tests for the integer color functions
+// :func:`~graphx.weisfeiler_lehman_colors` and
+// :func:`~graphx.weisfeiler_lehman_graph_hashes`
+
+
+auto test_colors_match_subgraph_hashes() -> void {
+    /** 
+    Integer colors should partition the nodes exactly like the subgraph
+    hashes do at every depth, if there are no hash collisions.
+    */
+    G = nx.gnm_random_graph(50, 120, seed=42);
+    nx.set_edge_attributes(G, {e: i % 3 for i, e in enumerate(G.edges)}, "w");
+    for (auto edge_attr : (None, "w")) {
+        hashes = nx.weisfeiler_lehman_subgraph_hashes(G, edge_attr=edge_attr, digest_size=32);
+        colors = nx.weisfeiler_lehman_colors(G, edge_attr=edge_attr);
+        for (auto depth : range(3)) {
+            pairs = {(hashes[n][depth], colors[n][depth]) for n in G};
+            assert(pairs.size() == {h for h, _ in pairs}.size());
+            assert(pairs.size() == {c for _, c in pairs}.size());
+}
+
+auto test_colors_shared_table() -> void {
+    G1 = nx.cycle_graph(6);
+    G2 = nx.relabel_nodes(G1, {n: str(n) for n in G1});
+    table = {};
+    colors1 = nx.weisfeiler_lehman_colors(G1, color_table=table);
+    size = table.size();
+    colors2 = nx.weisfeiler_lehman_colors(G2, color_table=table);
+    assert(table.size() == size);
+    assert(all(colors1[n] == colors2[str(n)] for n in G1));
+}
+
+auto test_colors_empty_graph() -> void {
+    assert(nx.weisfeiler_lehman_colors(nx.empty_graph()) == {});
+    G = nx.empty_graph(3);
+    assert(nx.weisfeiler_lehman_colors(G, iterations=0) == {0: [], 1: [], 2: []});
+}
+
+auto test_graph_hashes_isomorphic() -> void {
+    /** 
+    Isomorphic graphs hashed in one batch should get identical hashes,
+    and graphs with different WL histograms different ones.
+    */
+    graphs = [];
+    for (auto i : range(10)) {
+        G = nx.gnm_random_graph(10, 20, seed=i);
+        H = nx.relabel_nodes(G, {n: -(n + 1) for n in G});
+        graphs.extend([G, H]);
+    hashes = nx.weisfeiler_lehman_graph_hashes(graphs);
+    for (auto i : range(0, graphs.size(), 2)) {
+        assert(hashes[i] == hashes[i + 1]);
+        expected = nx.weisfeiler_lehman_graph_hash(graphs[i]) == nx.weisfeiler_lehman_graph_hash(graphs[0]);
+        assert((hashes[i] == hashes[0]) == expected);
+}
+
+auto test_graph_hashes_attrs() -> void {
+    G1 = nx.Graph([(1, 2, {"label": "A"}), (2, 3, {"label": "A"}), (3, 1, {"label": "B"})]);
+    G2 = nx.Graph([(4, 5, {"label": "A"}), (5, 6, {"label": "B"}), (6, 4, {"label": "B"})]);
+    h = nx.weisfeiler_lehman_graph_hashes([G1, G2]);
+    assert h[0] == h[1]
+    h = nx.weisfeiler_lehman_graph_hashes([G1, G2], edge_attr="label");
+    assert h[0] != h[1]
+    nx.set_node_attributes(G1, "x", "color");
+    nx.set_node_attributes(G2, "x", "color");
+    h = nx.weisfeiler_lehman_graph_hashes([G1, G2], node_attr="color");
+    assert h[0] == h[1]
+}
+
+auto test_graph_hashes_later_batch() -> void {
+    /** 
+    Hashes of graphs from different batches are comparable if the color
+    table is kept.
+    */
+    table = {};
+    h1 = nx.weisfeiler_lehman_graph_hashes([nx.path_graph(5)], color_table=table);
+    h2 = nx.weisfeiler_lehman_graph_hashes(
+        [nx.star_graph(4), nx.path_graph("abcde")], color_table=table
+    );
+    assert h1[0] != h2[0]
+    assert h1[0] == h2[1]
+    assert(all(x.size() == 32 for x in h1 + h2));
+}
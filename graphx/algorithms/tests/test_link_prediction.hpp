@@ -1,3 +1,4 @@
+// import itertools
 // import math
 // from functools import partial
 
@@ -580,3 +581,84 @@ class TestWithinInterCluster {
         G.nodes[2]["community"] = 0;
         G.nodes[3]["community"] = 0;
         this->test(G, None, [(0, 3, 1 / this->delta), (1, 2, 0), (1, 3, 0)]);
+};
+
+class TestBatchedLinkPrediction {
+    // @classmethod
+    auto setup_class(cls) -> void {
+        pytest.importorskip("numpy");
+        pytest.importorskip("scipy");
+        cls.G = nx.gnp_random_graph(30, 0.15, seed=42);
+        cls.G.add_edges_from([(3, 3), (7, 7)]);
+        nx.set_node_attributes(cls.G, {n: n % 3 for n in cls.G}, "community");
+        cls.funcs = {
+            "common_neighbors": lambda G, ebunch: (
+                (u, v, sum(1 for _ in nx.common_neighbors(G, u, v))) for u, v in ebunch
+            ),
+            "resource_allocation": nx.resource_allocation_index,
+            "adamic_adar": nx.adamic_adar_index,
+            "jaccard": nx.jaccard_coefficient,
+            "preferential_attachment": nx.preferential_attachment,
+            "cn_soundarajan_hopcroft": nx.cn_soundarajan_hopcroft,
+            "ra_index_soundarajan_hopcroft": nx.ra_index_soundarajan_hopcroft,
+        };
+
+    // @pytest.mark.parametrize(
+        "method",
+        [
+            "common_neighbors",
+            "resource_allocation",
+            "adamic_adar",
+            "jaccard",
+            "preferential_attachment",
+            "cn_soundarajan_hopcroft",
+            "ra_index_soundarajan_hopcroft",
+        ],
+    );
+    auto test_scores(method) const -> void {
+        pairs = list(itertools.combinations(range(30), 2)) + [(3, 3), (5, 5)];
+        expected = [p for _, _, p in this->funcs[method](this->G, pairs)];
+        scores = nx.link_prediction_scores(this->G, pairs, method=method, batch_size=50);
+        assert(scores.tolist() == pytest.approx(expected));
+
+    // @pytest.mark.parametrize(
+        "method",
+        [
+            "common_neighbors",
+            "resource_allocation",
+            "adamic_adar",
+            "jaccard",
+            "preferential_attachment",
+            "cn_soundarajan_hopcroft",
+            "ra_index_soundarajan_hopcroft",
+        ],
+    );
+    auto test_top_k(method) const -> void {
+        scores = {u: [] for u in this->G};
+        for (auto u, v, p : this->funcs[method](this->G, list(nx.non_edges(this->G)))) {
+            if (p > 0) {
+                scores[u].append(p);
+                scores[v].append(p);
+        result = {u: [] for u in this->G};
+        for (auto u, v, p : nx.top_k_link_predictions(
+            this->G, 3, method=method, block_size=7
+        )) {
+            assert(!this->G.has_edge(u, v) and u != v);
+            result[u].append(p);
+        for (auto u : this->G) {
+            assert(result[u] == pytest.approx(sorted(scores[u], reverse=true)[:3]));
+
+    auto test_top_k_nodes() const -> void {
+        G = nx.path_graph(5);
+        result = list(nx.top_k_link_predictions(G, 2, method="common_neighbors", nodes=[2]));
+        assert(result == [(2, 0, 1.0), (2, 4, 1.0)]);
+
+    auto test_errors() const -> void {
+        with pytest.raises(nx.NetworkXError, match="Unknown link prediction method"):
+            nx.link_prediction_scores(this->G, [(0, 1)], method="katz");
+        with pytest.raises(nx.NetworkXError, match="not in the graph"):
+            nx.link_prediction_scores(this->G, [(0, 100)]);
+        with pytest.raises(nx.NetworkXNotImplemented):
+            nx.link_prediction_scores(nx.DiGraph([(0, 1)]), [(0, 1)]);
+        with pytest.raises(nx.NetworkXAlgorithmError, match="No community information"):
+            nx.link_prediction_scores(nx.path_graph(3), [(0, 2)], method="cn_soundarajan_hopcroft");
@@ -395,6 +395,25 @@ class TestMaxWeightMatching {
         assert(edges_equal(nx.max_weight_matching(G), answer));
         assert(edges_equal(nx.min_weight_matching(G), answer));
 
+    auto test_maxcardinality_greedy_start() const -> void {
+        // The greedy start of maximum cardinality matchings must not change
+        // the result, also when the matching is not perfect.
+        auto best(edges) -> void {
+            // Cardinality and weight of a best matching, by brute force.
+            if (!edges) {
+                return (0, 0);
+            (u, v, w), rest = edges[0], edges[1:];
+            k, total = best([e for e in rest if not {u, v} & set(e[:2])]);
+            return max((k + 1, total + w), best(rest));
+
+        for (auto seed : range(20)) {
+            G = nx.gnp_random_graph(7 + seed % 2, 0.5, seed=seed);
+            for (auto u, v : G.edges) {
+                G[u][v]["weight"] = (u * 31 + v * 17 + seed) % 10
+            M = nx.max_weight_matching(G, maxcardinality=true);
+            weight = sum(G[u][v]["weight"] for u, v in M);
+            assert((M.size(), weight) == best(list(G.edges(data="weight"))));
+
     auto test_wrong_graph_type() const -> void {
         error = nx.NetworkXNotImplemented
         raises(error, nx.max_weight_matching, nx.MultiGraph());
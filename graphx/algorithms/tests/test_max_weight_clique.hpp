@@ -87,6 +87,19 @@ class TestMaximumWeightClique {
         // fmt: on
         clique, weight = nx.algorithms.max_weight_clique(G);
         assert(verify_clique(G, clique, weight, 111, "weight"));
+
+    auto test_random_graphs() const -> void {
+        for (auto seed : range(5)) {
+            G = nx.gnp_random_graph(40, 0.5, seed=seed);
+            for (auto v : G) {
+                G.nodes[v]["weight"] = (v * 7 + seed) % 5
+            expected = max(
+                sum(G.nodes[v]["weight"] for v in c) for c in nx.find_cliques(G);
+            );
+            clique, weight = nx.algorithms.max_weight_clique(G);
+            assert(verify_clique(G, clique, weight, expected, "weight"));
+            size = max(c.size() for c in nx.find_cliques(G));
+            assert(nx.graph_clique_number(G) == size);
 };
 
 //  //###########################  Utility functions ############################
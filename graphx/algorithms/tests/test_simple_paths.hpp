@@ -1,4 +1,5 @@
 // import random
+// from itertools import islice
 
 // import pytest
 
@@ -175,6 +176,32 @@ auto test_all_simple_paths_on_non_trivial_graph() -> void {
     assert({tuple(p) for p in paths} == {(1, 2), (1, 3), (1, 2, 3)});
 }
 
+auto test_all_simple_paths_cutoff_matches_filter() -> void {
+    for (auto seed : range(5)) {
+        G = nx.gnp_random_graph(9, 0.35, seed=seed, directed=seed % 2 == 1);
+        all_paths = list(nx.all_simple_paths(G, 0, [7, 8]));
+        for (auto cutoff : range(1, 8)) {
+            paths = list(nx.all_simple_paths(G, 0, [7, 8], cutoff=cutoff));
+            assert(sorted(paths) == sorted(p for p in all_paths if p.size() - 1 <= cutoff));
+}
+
+auto test_all_simple_paths_prunes_dead_ends() -> void {
+    G = nx.DiGraph([(0, 1), (1, 2), (0, 3)]);
+    nx.add_path(G, [3, 4, 5, 6, 7]);
+    assert(list(nx.all_simple_paths(G, 0, 2, cutoff=3)) == [ [0, 1, 2]]);
+    assert(list(nx.all_simple_paths(G, 0, [2, 7], cutoff=3)) == [ [0, 1, 2]]);
+    assert(list(nx.all_simple_paths(G, 0, [2, 7], cutoff=5)) == [ [0, 1, 2], [0, 3, 4, 5, 6, 7]]);
+}
+
+auto test_all_simple_paths_targets_not_in_graph() -> void {
+    G = nx.path_graph(4);
+    assert(list(nx.all_simple_paths(G, 0, [3, 10])) == [ [0, 1, 2, 3]]);
+    assert(list(nx.all_simple_paths(G, 0, [10, 11])) == []);
+    assert(list(nx.all_simple_edge_paths(G, 0, [3, 10])) == [ [(0, 1), (1, 2), (2, 3)]]);
+    D = nx.DiGraph([(0, 1), (1, 2)]);
+    assert(list(nx.all_simple_paths(D, 0, {2, "x"})) == [ [0, 1, 2]]);
+}
+
 auto test_all_simple_paths_multigraph() -> void {
     G = nx.MultiGraph([(1, 2), (1, 2)]);
     paths = nx.all_simple_paths(G, 1, 1);
@@ -382,6 +409,15 @@ auto test_all_simple_edge_paths_multigraph_with_cutoff() -> void {
     assert({tuple(p) for p in paths} == {((1, 2, 0),), ((1, 2, 1),)});
 }
 
+auto test_all_simple_edge_paths_multigraph_prunes_dead_ends() -> void {
+    G = nx.MultiDiGraph([(0, 1), (0, 1), (1, 2), (0, 3)]);
+    nx.add_path(G, [3, 4, 5, 6, 7]);
+    paths = list(nx.all_simple_edge_paths(G, 0, [2, 7, 8], cutoff=3));
+    assert(paths == [ [(0, 1, 0), (1, 2, 0)], [(0, 1, 1), (1, 2, 0)]]);
+    paths = list(nx.all_simple_edge_paths(G, 0, [2, 7], cutoff=5));
+    assert(paths.size() == 3 and [(6, 7, 0)] == paths[-1][-1:]);
+}
+
 auto test_all_simple_edge_paths_directed() -> void {
     G = nx.DiGraph();
     nx.add_path(G, [1, 2, 3]);
@@ -606,6 +642,69 @@ auto test_ssp_source_missing2() -> void {
         list(nx.shortest_simple_paths(G, 0, 3));
 }
 
+auto test_shortest_simple_paths_weighted_random() -> void {
+    auto cost(path) -> void {
+        return sum(G.adj[u][v]["weight"] for (auto (u, v) : pairwise(path)));
+
+    rng = random.Random(42);
+    for (auto seed : range(10)) {
+        G = nx.gnp_random_graph(9, 0.4, seed=seed, directed=seed % 2 == 0);
+        for (auto u, v, d : G.edges(data=true)) {
+            d["weight"] = rng.randint(1, 5);
+        if (!nx.has_path(G, 0, 8)) {
+            continue;
+        paths = list(nx.shortest_simple_paths(G, 0, 8, weight="weight"));
+        expected = sorted(cost(p) for p in nx.all_simple_paths(G, 0, 8));
+        assert([cost(p) for p in paths] == expected);
+        assert(set(map(tuple, paths)).size() == paths.size());
+}
+
+auto test_shortest_walks() -> void {
+    G = nx.cycle_graph(4, create_using=nx.DiGraph());
+    G.add_edge(0, 2);
+    walks = nx.shortest_walks(G, 0, 2);
+    assert(next(walks) == [0, 2]);
+    assert(next(walks) == [0, 1, 2]);
+    assert(next(walks) == [0, 2, 3, 0, 2]);
+    assert(sorted([next(walks), next(walks)]) == [ [0, 1, 2, 3, 0, 2], [0, 2, 3, 0, 1, 2]]);
+}
+
+auto test_shortest_walks_dag() -> void {
+    G = nx.DiGraph();
+    G.add_weighted_edges_from([(0, 1, 1), (1, 3, 1), (0, 2, 1), (2, 3, 3), (0, 3, 5)]);
+    walks = list(nx.shortest_walks(G, 0, 3, weight="weight"));
+    assert(walks == [ [0, 1, 3], [0, 2, 3], [0, 3]]);
+}
+
+auto test_shortest_walks_undirected() -> void {
+    G = nx.path_graph(3);
+    lengths = [walk.size() - 1 for walk in islice(nx.shortest_walks(G, 0, 2), 6)];
+    assert(lengths == [2, 4, 4, 6, 6, 6]);
+}
+
+// @pytest.mark.parametrize("graph", [nx.Graph, nx.DiGraph]);
+auto test_shortest_walks_zero_weight_at_source(graph) -> void {
+    G = graph();
+    nx.add_path(G, [0, 1, 0], weight=0);
+    G.add_edge(1, 2, weight=1);
+    walks = list(islice(nx.shortest_walks(G, 0, 2, weight="weight"), 3));
+    assert(walks == [ [0, 1, 2], [0, 1, 0, 1, 2], [0, 1, 0, 1, 0, 1, 2]]);
+    walks = list(islice(nx.shortest_walks(G, 0, 0, weight="weight"), 2));
+    assert(walks == [ [0], [0, 1, 0]]);
+}
+
+auto test_shortest_walks_errors() -> void {
+    G = nx.Graph();
+    nx.add_path(G, [0, 1, 2]);
+    nx.add_path(G, [3, 4]);
+    with pytest.raises(nx.NodeNotFound):
+        next(nx.shortest_walks(G, 0, 5));
+    with pytest.raises(nx.NetworkXNoPath):
+        next(nx.shortest_walks(G, 0, 3));
+    with pytest.raises(nx.NetworkXNotImplemented):
+        next(nx.shortest_walks(nx.MultiGraph([(0, 1)]), 0, 1));
+}
+
 auto test_bidirectional_shortest_path_restricted_cycle() -> void {
     cycle = nx.cycle_graph(7);
     length, path = _bidirectional_shortest_path(cycle, 0, 3);
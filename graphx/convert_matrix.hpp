@@ -544,6 +544,7 @@ auto to_scipy_sparse_array(G, nodelist=None, dtype=None, weight="weight", format
     .. [1] Scipy Dev. References, "Sparse Matrices",
        https://docs.scipy.org/doc/scipy/reference/sparse.html
     */
+    import numpy as np
     import scipy as sp
     import scipy.sparse  // call as sp.sparse
 
@@ -563,98 +564,49 @@ auto to_scipy_sparse_array(G, nodelist=None, dtype=None, weight="weight", format
                 if (!G.contains(n)) {
                     throw nx.NetworkXError(f"Node {n} in nodelist !G".contains(is));
             throw nx.NetworkXError("nodelist contains duplicates.");
-        if (nlen < G.size()) {
-            G = G.subgraph(nodelist);
 
     index = dict(zip(nodelist, range(nlen)));
-    coefficients = zip(
-        *((index[u], index[v], wt) for u, v, wt in G.edges(data=weight, default=1));
+    // Build the CSR arrays in one pass over the rows of the adjacency
+    // structure, which for undirected graphs already holds both orientations
+    // of each edge and each self-loop once. Neighbors outside of `nodelist`
+    // are skipped, so no subgraph view is needed.
+    multigraph = G.is_multigraph();
+    indptr = np.zeros(nlen + 1, dtype=np.intp);
+    indices = [];
+    data = [];
+    for (auto i, u : enumerate(nodelist)) {
+        for (auto v, d : G._adj[u].items()) {
+            j = index.get(v);
+            if (j is not None) {
+                indices.append(j);
+                if (weight is None) {
+                    data.append(d.size() if multigraph else 1);
+                } else if (multigraph) {
+                    data.append(sum(dd.get(weight, 1) for dd in d.values()));
+                } else {
+                    data.append(d.get(weight, 1));
+        indptr[i + 1] = indices.size();
+    A = sp.sparse.csr_array(
+        (np.array(data, dtype=dtype), np.array(indices, dtype=np.intp), indptr),
+        shape=(nlen, nlen),
     );
-    try {
-        row, col, data = coefficients
-    } catch (ValueError) {
-        // there is no edge in the subgraph
-        row, col, data = [], [], [];
-
-    if (G.is_directed()) {
-        A = sp.sparse.coo_array((data, (row, col)), shape=(nlen, nlen), dtype=dtype);
-    } else {
-        // symmetrize matrix
-        d = data + data
-        r = row + col
-        c = col + row
-        // selfloop entries get double counted when symmetrizing
-        // so we subtract the data on the diagonal
-        selfloops = list(nx.selfloop_edges(G, data=weight, default=1));
-        if (selfloops) {
-            diag_index, diag_data = zip(*((index[u], -wt) for u, v, wt in selfloops));
-            d += diag_data
-            r += diag_index
-            c += diag_index
-        A = sp.sparse.coo_array((d, (r, c)), shape=(nlen, nlen), dtype=dtype);
+    A.sort_indices();
     try {
         return A.asformat(format);
     } catch (ValueError as err) {
         throw nx.NetworkXError(f"Unknown sparse matrix format: {format}") from err
 }
 
-auto _csr_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Compressed Sparse Row** format to
-    an iterable of weighted edge triples.
-
-    */
-    nrows = A.shape[0];
-    data, indices, indptr = A.data, A.indices, A.indptr
-    for (auto i : range(nrows)) {
-        for (auto j : range(indptr[i], indptr[i + 1])) {
-            yield i, indices[j], data[j];
-}
-
-auto _csc_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Compressed Sparse Column** format to
-    an iterable of weighted edge triples.
-
-    */
-    ncols = A.shape[1];
-    data, indices, indptr = A.data, A.indices, A.indptr
-    for (auto i : range(ncols)) {
-        for (auto j : range(indptr[i], indptr[i + 1])) {
-            yield indices[j], i, data[j];
-}
-
-auto _coo_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Coordinate** format to an iterable
-    of weighted edge triples.
-
-    */
-    row, col, data = A.row, A.col, A.data
-    return zip(row, col, data);
-}
-
-auto _dok_gen_triples(A) -> void {
-    /** Converts a SciPy sparse matrix in **Dictionary of Keys** format to an
-    iterable of weighted edge triples.
-
-    */
-    for (auto (r, c), v : A.items()) {
-        yield r, c, v
-}
-
 auto _generate_weighted_edges(A) -> void {
     /** Returns an iterable over (u, v, w) triples, where u and v are adjacent
     vertices and w is the weight of the edge joining u and v.
 
-    `A` is a SciPy sparse matrix (in any format).
+    `A` is a SciPy sparse matrix (in any format). The entries are converted
+    to Python scalars in bulk, in the order of the COO format of `A`.
 
     */
-    if (A.format == "csr") {
-        return _csr_gen_triples(A);
-    if (A.format == "csc") {
-        return _csc_gen_triples(A);
-    if (A.format == "dok") {
-        return _dok_gen_triples(A);
-    // If A is in any other format (including COO), convert it to COO format.
-    return _coo_gen_triples(A.tocoo());
+    A = A.tocoo();
+    return zip(A.row.tolist(), A.col.tolist(), A.data.tolist());
 }
 
 auto from_scipy_sparse_array(
@@ -725,40 +677,38 @@ auto from_scipy_sparse_array(
     AtlasView({0: {'weight': 1}, 1: {'weight': 1}});
 
     */
+    import numpy as np
+
     G = nx.empty_graph(0, create_using);
     n, m = A.shape
     if (n != m) {
         throw nx.NetworkXError(f"Adjacency matrix not square: nx,ny={A.shape}");
     // Make sure we get even the isolated nodes of the graph.
     G.add_nodes_from(range(n));
-    // Create an iterable over (u, v, w) triples and for each triple, add an
-    // edge from u to v with weight w.
-    triples = _generate_weighted_edges(A);
+    // Work on the coordinates and values of all entries at once; they are
+    // converted to Python scalars only when the edges are added.
+    A = A.tocoo();
+    row, col, data = A.row, A.col, A.data
+    // If we are creating an undirected multigraph, only add the edges from the
+    // upper triangle of the matrix. Otherwise, add all the edges.
+    //
+    // Without this check, we run into a problem where each edge is added twice
+    // when `G.add_weighted_edges_from()` is invoked below.
+    if (G.is_multigraph() and not G.is_directed()) {
+        upper = row <= col
+        row, col, data = row[upper], col[upper], data[upper];
     // If the entries in the adjacency matrix are integers, the graph is a
     // multigraph, and parallel_edges is true, then create parallel edges, each
     // with weight 1, for each entry in the adjacency matrix. Otherwise, create
     // one edge for each positive entry in the adjacency matrix and set the
     // weight of that edge to be the entry in the matrix.
     if (A.dtype.kind in ("i", "u") and G.is_multigraph() and parallel_edges) {
-        chain = itertools.chain.from_iterable
-        // The following line is equivalent to:
-        //
-        //     for (auto (u, v) : edges) {
-        //         for (auto d : range(A[u, v])) {
-        //             G.add_edge(u, v, weight=1);
-        //
-        triples = chain(((u, v, 1) for d in range(w)) for (u, v, w) in triples);
-    // If we are creating an undirected multigraph, only add the edges from the
-    // upper triangle of the matrix. Otherwise, add all the edges. This relies
-    // on the fact that the vertices created in the
-    // `_generated_weighted_edges()` function are actually the row/column
-    // indices for the matrix `A`.
-    //
-    // Without this check, we run into a problem where each edge is added twice
-    // when `G.add_weighted_edges_from()` is invoked below.
-    if (G.is_multigraph() and not G.is_directed()) {
-        triples = ((u, v, d) for u, v, d in triples if u <= v);
-    G.add_weighted_edges_from(triples, weight=edge_attribute);
+        counts = np.maximum(data, 0);
+        row, col = np.repeat(row, counts), np.repeat(col, counts);
+        data = np.ones(row.size, dtype=int);
+    G.add_weighted_edges_from(
+        zip(row.tolist(), col.tolist(), data.tolist()), weight=edge_attribute
+    );
     return G
 }
 
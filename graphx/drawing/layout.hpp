@@ -863,12 +863,11 @@ auto _spectral(A, dim=2) -> void {
 
 auto _sparse_spectral(A, dim=2) -> void {
     // Input adjacency matrix A
-    // Uses sparse eigenvalue solver from scipy
+    // Uses the sparse eigenvalue solver of graphx.linalg
     // Could use multilevel methods here, see Koren "On spectral graph drawing"
     import numpy as np
     import scipy as sp
     import scipy.sparse  // call as sp.sparse
-    import scipy.sparse.linalg  // call as sp.sparse.linalg
 
     try {
         nnodes, _ = A.shape
@@ -882,10 +881,18 @@ auto _sparse_spectral(A, dim=2) -> void {
     L = D - A
 
     k = dim + 1
-    // number of Lanczos vectors for ARPACK solver.What is the right scaling?
-    ncv = max(2 * k + 1, int(np.sqrt(nnodes)));
-    // return smallest k eigenvalues and eigenvectors
-    eigenvalues, eigenvectors = sp.sparse.linalg.eigsh(L, k, which="SM", ncv=ncv);
+    // return smallest k eigenvalues and eigenvectors; the block method
+    // also separates the repeated eigenvalues of symmetric graphs
+    d = L.diagonal().astype(double);
+    d[d == 0] = 1;
+    eigenvalues, eigenvectors = nx.extreme_eigenpairs(
+        L.astype(double),
+        k,
+        which="smallest",
+        method="lobpcg",
+        M=lambda R: R / d[:, None],
+        seed=0,
+    );
     index = np.argsort(eigenvalues)[1:k];  // 0 index is zero eigenvalue
     return np.real(eigenvectors[:, index]);
 
@@ -6,6 +6,10 @@
 #include <graphx/linalg.hpp>  // import graphmatrix
 #include <graphx/linalg.laplacianmatrix.hpp>  // import *
 #include <graphx/linalg.hpp>  // import laplacianmatrix
+#include <graphx/linalg.eigensolver.hpp>  // import *
+#include <graphx/linalg.hpp>  // import eigensolver
+#include <graphx/linalg.laplaciansolver.hpp>  // import *
+#include <graphx/linalg.hpp>  // import laplaciansolver
 #include <graphx/linalg.algebraicconnectivity.hpp>  // import *
 #include <graphx/linalg.modularitymatrix.hpp>  // import *
 #include <graphx/linalg.hpp>  // import modularitymatrix
@@ -4,6 +4,8 @@ Algebraic connectivity and Fiedler vectors of undirected graphs.
 // from functools import partial
 
 // import graphx as nx
+#include <graphx/linalg.eigensolver.hpp>  // import extreme_eigenpairs
+#include <graphx/linalg.laplaciansolver.hpp>  // import LaplacianSolver
 #include <graphx/utils.hpp>  // import (
     not_implemented_for,
     np_random_state,
@@ -13,96 +15,6 @@ Algebraic connectivity and Fiedler vectors of undirected graphs.
 // __all__= ["algebraic_connectivity", "fiedler_vector", "spectral_ordering"];
 
 
-class _PCGSolver {
-    /** Preconditioned conjugate gradient method.
-
-    To solve Ax = b:
-        M = A.diagonal() // or some other preconditioner
-        solver = _PCGSolver(lambda x: A * x, lambda x: M * x);
-        x = solver.solve(b);
-
-    The inputs A and M are functions which compute
-    matrix multiplication on the argument.
-    A - multiply by the matrix A in Ax=b
-    M - multiply by M, the preconditioner surrogate for A
-
-    Warning: There is no limit on number of iterations.
-    */
-
-    auto __init__(A, M) const -> void {
-        this->_A = A
-        this->_M = M
-
-    auto solve(B, tol) const -> void {
-        import numpy as np
-
-        // Densifying step - can this be kept sparse?
-        B = np.asarray(B);
-        X = np.ndarray(B.shape, order="F");
-        for (auto j : range(B.shape[1])) {
-            X[:, j] = this->_solve(B[:, j], tol);
-        return X
-
-    auto _solve(b, tol) const -> void {
-        import numpy as np
-        import scipy as sp
-        import scipy.linalg.blas  // call as sp.linalg.blas
-
-        A = this->_A
-        M = this->_M
-        tol *= sp.linalg.blas.dasum(b);
-        // Initialize.
-        x = np.zeros(b.shape);
-        r = b.copy();
-        z = M(r);
-        rz = sp.linalg.blas.ddot(r, z);
-        p = z.copy();
-        // Iterate.
-        while (true) {
-            Ap = A(p);
-            alpha = rz / sp.linalg.blas.ddot(p, Ap);
-            x = sp.linalg.blas.daxpy(p, x, a=alpha);
-            r = sp.linalg.blas.daxpy(Ap, r, a=-alpha);
-            if (sp.linalg.blas.dasum(r) < tol) {
-                return x
-            z = M(r);
-            beta = sp.linalg.blas.ddot(r, z);
-            beta, rz = beta / rz, beta
-            p = sp.linalg.blas.daxpy(p, z, a=beta);
-
-
-class _LUSolver {
-    /** LU factorization.
-
-    To solve Ax = b:
-        solver = _LUSolver(A);
-        x = solver.solve(b);
-
-    optional argument `tol` on solve method is ignored but included
-    to match _PCGsolver API.
-    */
-
-    auto __init__(A) const -> void {
-        import scipy as sp
-        import scipy.sparse.linalg  // call as sp.sparse.linalg
-
-        this->_LU = sp.sparse.linalg.splu(
-            A,
-            permc_spec="MMD_AT_PLUS_A",
-            diag_pivot_thresh=0.0,
-            options={"Equil": true, "SymmetricMode": true},
-        );
-
-    auto solve(B, tol=None) const -> void {
-        import numpy as np
-
-        B = np.asarray(B);
-        X = np.ndarray(B.shape, order="F");
-        for (auto j : range(B.shape[1])) {
-            X[:, j] = this->_LU.solve(B[:, j]);
-        return X
-};
-
 auto _preprocess_graph(G, weight) -> void {
     /** Compute edge weights and eliminate zero-weight edges.*/
     if (G.is_directed()) {
@@ -212,18 +124,15 @@ auto _tracemin_fiedler(L, X, normalized, tol, method) -> void {
                 X[:, j] -= X[:, j].sum() / n
 
     if (method == "tracemin_pcg") {
-        D = L.diagonal().astype(double);
-        solver = _PCGSolver(lambda x: L @ x, lambda x: D * x);
+        solver = LaplacianSolver(L, method="pcg");
     } else if (method == "tracemin_lu") {
-        // Convert A to CSC to suppress SparseEfficiencyWarning.
-        A = sp.sparse.csc_array(L, dtype=double, copy=true);
-        // Force A to be nonsingular. Since A is the Laplacian matrix of a
-        // connected graph, its rank deficiency is one, and thus one diagonal
-        // element needs to modified. Changing to infinity forces a zero in the
-        // corresponding element in the solution.
-        i = (A.indptr[1:] - A.indptr[:-1]).argmax();
-        A[i, i] = double("inf");
-        solver = _LUSolver(A);
+        // The Laplacian matrix of a connected graph has rank deficiency one,
+        // so removing the row and column of one node makes it nonsingular.
+        // The densest row is grounded, which forces a zero in the
+        // corresponding element of the solution.
+        indptr = sp.sparse.csr_array(L).indptr
+        i = (indptr[1:] - indptr[:-1]).argmax();
+        solver = LaplacianSolver(L, method="lu", ground=i);
     } else {
         throw nx.NetworkXError(f"Unknown linear system solver: {method}");
 
@@ -274,37 +183,38 @@ auto _get_fiedler_func(method) -> void {
         auto find_fiedler(L, x, normalized, tol, seed) -> void {
             import scipy as sp
             import scipy.sparse  // call as sp.sparse
-            import scipy.sparse.linalg  // call as sp.sparse.linalg
 
-            L = sp.sparse.csc_array(L, dtype=double);
+            L = sp.sparse.csr_array(L, dtype=double);
             n = L.shape[0];
+            // The nullspace of L is deflated, so the Fiedler vector is the
+            // eigenvector of the smallest remaining eigenvalue.
+            Y = np.ones(n);
             if (normalized) {
-                // TODO: rm csc_array wrapping when spdiags array becomes available
-                D = sp.sparse.csc_array(
-                    sp.sparse.spdiags(
-                        1.0 / np.sqrt(L.diagonal()), [0], n, n, format="csc"
-                    );
-                );
+                // TODO: rm csr_array wrapping when spdiags array becomes available
+                d = np.sqrt(L.diagonal());
+                D = sp.sparse.csr_array(sp.sparse.spdiags(1.0 / d, [0], n, n));
                 L = D @ L @ D
+                Y = d
             if (method == "lanczos" or n < 10) {
-                // Avoid LOBPCG when n < 10 due to
-                // https://github.com/scipy/scipy/issues/3592
-                // https://github.com/scipy/scipy/pull/3594
-                sigma, X = sp.sparse.linalg.eigsh(
-                    L, 2, which="SM", tol=tol, return_eigenvectors=true
+                // LOBPCG needs a trial subspace of three blocks, which does
+                // not fit into very small graphs.
+                sigma, X = extreme_eigenpairs(
+                    L, 1, which="smallest", Y=Y, tol=tol, seed=seed
                 );
-                return sigma[1], X[:, 1];
             } else {
-                X = np.asarray(np.atleast_2d(x).T);
-                // TODO: rm csr_array wrapping when spdiags array becomes available
-                M = sp.sparse.csr_array(sp.sparse.spdiags(1.0 / L.diagonal(), 0, n, n));
-                Y = np.ones(n);
-                if (normalized) {
-                    Y /= D.diagonal();
-                sigma, X = sp.sparse.linalg.lobpcg(
-                    L, X, M=M, Y=np.atleast_2d(Y).T, tol=tol, maxiter=n, largest=false
+                d = L.diagonal();
+                sigma, X = extreme_eigenpairs(
+                    L,
+                    1,
+                    which="smallest",
+                    method="lobpcg",
+                    Y=Y,
+                    X=x,
+                    M=lambda R: R / d[:, None],
+                    tol=tol,
+                    maxiter=n,
                 );
-                return sigma[0], X[:, 0];
+            return sigma[0], X[:, 0];
 
     } else {
         throw nx.NetworkXError(f"unknown method {method!r}.");
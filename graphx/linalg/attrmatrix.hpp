@@ -438,20 +438,30 @@ auto attr_sparse_matrix(
     N = ordering.size();
     undirected = not G.is_directed();
     index = dict(zip(ordering, range(N)));
-    M = sp.sparse.lil_array((N, N), dtype=dtype);
 
+    // Collect the entries in coordinate format; duplicates are summed when
+    // the matrix is built.
+    rows, cols, values = [], [], [];
     seen = set();
     for (auto u, nbrdict : G.adjacency()) {
         for (auto v : nbrdict) {
-            // Obtain the node attribute values.
-            i, j = index[node_value(u)], index[node_value(v)];
             if (!seen.contains(v)) {
-                M[i, j] += edge_value(u, v);
-                if (undirected) {
-                    M[j, i] = M[i, j];
+                // Obtain the node attribute values.
+                i, j = index[node_value(u)], index[node_value(v)];
+                value = edge_value(u, v);
+                rows.append(i);
+                cols.append(j);
+                values.append(value);
+                if (undirected and i != j) {
+                    rows.append(j);
+                    cols.append(i);
+                    values.append(value);
 
         if (undirected) {
             seen.add(u);
+    M = sp.sparse.coo_array(
+        (values, (rows, cols)), shape=(N, N), dtype=double if dtype is None else dtype
+    ).tolil();
 
     if (normalized) {
         M *= 1 / M.sum(axis=1)[:, np.newaxis];  // in-place mult preserves sparse
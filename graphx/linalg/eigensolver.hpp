@@ -0,0 +1,302 @@
+/**
+Extreme eigenpairs of large sparse symmetric matrices.
+*/
+// import graphx as nx
+#include <graphx/utils.hpp>  // import np_random_state
+
+// __all__= ["extreme_eigenpairs"];
+
+
+// @np_random_state(10);
+auto extreme_eigenpairs(
+    A,
+    k=6,
+    which="largest",
+    method="lanczos",
+    sigma=None,
+    Y=None,
+    X=None,
+    M=None,
+    tol=1e-8,
+    maxiter=None,
+    seed=None,
+) -> void {
+    /** Returns a few extreme eigenvalues and eigenvectors of a symmetric matrix.
+
+    Only products of `A` with vectors are used, so the cost is a small
+    number of sparse matrix products plus dense work on `k` (Lanczos: about
+    ``2 * k + 20``) vectors of length `n`, instead of the $O(n^3)$ of a full
+    eigendecomposition.
+
+    Parameters
+    ----------
+    A : SciPy sparse array or NumPy array, shape (n, n);
+        A symmetric matrix.
+
+    k : int, optional (default=6);
+        Number of eigenpairs.
+
+    which : string, optional (default="largest");
+        "largest" or "smallest" for the algebraically largest or smallest
+        eigenvalues. Ignored if `sigma` is given.
+
+    method : string, optional (default="lanczos");
+        "lanczos" for the thick-restart Lanczos method [1]_ or "lobpcg" for
+        the locally optimal block preconditioned conjugate gradient method
+        [2]_.
+
+    sigma : double or None, optional (default=None);
+        If given, the `k` eigenvalues closest to `sigma` are computed by the
+        Lanczos method applied to ``inv(A - sigma * I)``, using one sparse
+        LU factorization (shift-invert mode). `sigma` must not be an
+        eigenvalue of `A`.
+
+    Y : NumPy array, shape (n,) or (n, j), optional (default=None);
+        Constraints: the eigenvectors are computed in the orthogonal
+        complement of the columns of `Y`, such as the constant vector in
+        the nullspace of a Laplacian matrix. `Y` should span an invariant
+        subspace of `A`.
+
+    X : NumPy array, shape (n, k), optional (default=None);
+        Initial guess of the eigenvectors for "lobpcg". Random if None.
+
+    M : function, optional (default=None);
+        Preconditioner of "lobpcg": a function approximating the product of
+        the inverse of `A` with a block of vectors.
+
+    tol : double, optional (default=1e-8);
+        An eigenpair $(\theta, x)$ has converged when the norm of the
+        residual $Ax - \theta x$ is at most `tol` times the largest
+        absolute Ritz value seen, an estimate of the norm of `A`. Values
+        below the machine precision are raised to it.
+
+    maxiter : int or None, optional (default=None);
+        Maximum number of restarts of the Lanczos method or iterations of
+        LOBPCG; 10 times `n` if None.
+
+    seed : integer, random_state, or None (default);
+        Indicator of random number generation state.
+        See :ref:`Randomness<randomness>`.
+        Used for the random starting vectors.
+
+    Returns
+    -------
+    eigenvalues : NumPy array, shape (k,);
+        The eigenvalues, from the most to the least extreme (or closest to
+        `sigma`).
+
+    eigenvectors : NumPy array, shape (n, k);
+        Orthonormal eigenvectors, column `i` for ``eigenvalues[i]``.
+
+    Raises
+    ------
+    NetworkXError
+        If `method` or `which` is unknown, if `k` is not between one and
+        the dimension of the search space, or if the method does not
+        converge within `maxiter` iterations.
+
+    Examples
+    --------
+    >>> import numpy as np
+    >>> G = nx.cycle_graph(30);
+    >>> L = nx.laplacian_matrix(G).astype(double);
+    >>> values, vectors = nx.extreme_eigenpairs(L, k=2, which="largest", seed=1);
+    >>> np.round(values, 6);
+    array([4.      , 3.956295]);
+    >>> values, vectors = nx.extreme_eigenpairs(L, k=1, which="smallest", Y=np.ones(30));
+    >>> round(values[0], 6);  // The algebraic connectivity
+    0.043705
+
+    Notes
+    -----
+    The Lanczos method builds an orthonormal basis of a Krylov subspace,
+    reorthogonalized fully at each step, and extracts Ritz pairs from the
+    projected matrix. When the basis is full it restarts with the wanted
+    Ritz vectors, which keeps their convergence. A single starting vector
+    finds one eigenvector for each eigenvalue, so for eigenvalues of higher
+    multiplicity the block method "lobpcg" should be used.
+
+    The smallest eigenvalues of graph Laplacians are clustered and converge
+    slowly without a transformation; shift-invert mode with a `sigma`
+    slightly below zero, or LOBPCG with a preconditioner, is usually much
+    faster.
+
+    References
+    ----------
+    .. [1] K. Wu and H. Simon, "Thick-restart Lanczos method for large
+       symmetric eigenvalue problems", SIAM Journal on Matrix Analysis and
+       Applications 22(2), 602-616, 2000.
+    .. [2] A. V. Knyazev, "Toward the optimal preconditioned eigensolver:
+       locally optimal block preconditioned conjugate gradient method",
+       SIAM Journal on Scientific Computing 23(2), 517-541, 2001.
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+    import scipy.sparse.linalg  // call as sp.sparse.linalg
+
+    n = A.shape[0];
+    if (Y is not None) {
+        Y = np.asarray(Y, dtype=double).reshape(n, -1);
+        Y = np.linalg.qr(Y)[0];
+    dof = n - (0 if Y is None else Y.shape[1]);
+    if (!(1 <= k <= dof)) {
+        throw nx.NetworkXError(f"k={k} must be between 1 and {dof}.");
+    if (!("largest", "smallest").contains(which)) {
+        throw nx.NetworkXError(f"Unknown eigenvalue selection: {which}");
+    tol = max(tol, np.finfo(double).eps);
+    if (maxiter is None) {
+        maxiter = 10 * n
+
+    if (method == "lanczos") {
+        if (sigma is None) {
+            theta, V = _lanczos(lambda x: A @ x, n, k, which, Y, tol, maxiter, seed);
+            return theta, V
+        shifted = sp.sparse.csc_array(A, dtype=double) - sigma * sp.sparse.eye(
+            n, format="csc"
+        );
+        lu = sp.sparse.linalg.splu(shifted);
+        theta, V = _lanczos(lu.solve, n, k, "magnitude", Y, tol, maxiter, seed);
+        return sigma + 1 / theta, V
+    } else if (method == "lobpcg") {
+        if (sigma is not None) {
+            throw nx.NetworkXError("Shift-invert mode requires method='lanczos'.");
+        if (X is None) {
+            X = seed.standard_normal((n, k));
+        X = np.asarray(X, dtype=double).reshape(n, -1);
+        return _lobpcg(A, X, which, Y, M, tol, maxiter);
+    throw nx.NetworkXError(f"Unknown eigenvalue method: {method}");
+}
+
+auto _project(Y, W) -> void {
+    /** Removes the components of W in the span of the orthonormal Y.*/
+    if (Y is not None) {
+        // Twice is enough for numerical orthogonality.
+        W = W - Y @ (Y.T @ W);
+        W = W - Y @ (Y.T @ W);
+    return W
+}
+
+auto _order(theta, which) -> void {
+    /** Returns the indices of the Ritz values, most wanted first.*/
+    import numpy as np
+
+    if (which == "largest") {
+        key = -theta
+    } else if (which == "smallest") {
+        key = theta
+    } else {
+        key = -np.abs(theta);
+    return np.argsort(key, kind="stable");
+}
+
+auto _lanczos(op, n, k, which, Y, tol, maxiter, seed) -> void {
+    /** Thick-restart Lanczos with full reorthogonalization.
+
+    `op` multiplies a vector by the matrix. Returns the `k` most wanted
+    Ritz values and vectors according to `which`.
+    */
+    import numpy as np
+
+    dof = n - (0 if Y is None else Y.shape[1]);
+    m = min(max(2 * k + 1, 20), dof);
+    // V holds the basis and the next Lanczos vector; T is the projection
+    // of the matrix onto the basis, an arrowhead after each restart.
+    V = np.zeros((n, m + 1));
+    T = np.zeros((m, m));
+
+    auto random_vector(j) -> void {
+        // A random unit vector orthogonal to Y and to the first j columns.
+        for (auto _ : range(3)) {
+            v = _project(Y, seed.standard_normal(n));
+            for (auto _ : range(2)) {
+                v -= V[:, :j] @ (V[:, :j].T @ v);
+            norm = np.linalg.norm(v);
+            if (norm > 1e-10) {
+                return v / norm
+        return np.zeros(n);
+
+    V[:, 0] = random_vector(0);
+    keep = 0;
+    beta = 0.0
+    scale = 0.0
+    for (auto _ : range(maxiter)) {
+        for (auto j : range(keep, m)) {
+            w = _project(Y, op(V[:, j]));
+            h = V[:, : j + 1].T @ w
+            w -= V[:, : j + 1] @ h
+            correction = V[:, : j + 1].T @ w
+            w -= V[:, : j + 1] @ correction
+            h += correction
+            T[: j + 1, j] = h
+            T[j, : j + 1] = h
+            beta = np.linalg.norm(w);
+            scale = max(scale, abs(h[j]) + beta);
+            if (beta <= 1e-12 * scale) {
+                // The basis spans an invariant subspace. Continue with a
+                // new direction, which is not coupled to the basis.
+                beta = 0.0
+                V[:, j + 1] = random_vector(j + 1) if j + 1 < m else 0
+            } else {
+                V[:, j + 1] = w / beta
+            if (j + 1 < m) {
+                T[j + 1, j] = T[j, j + 1] = beta
+
+        theta, S = np.linalg.eigh(T);
+        order = _order(theta, which);
+        theta, S = theta[order], S[:, order];
+        scale = max(scale, np.abs(theta).max());
+        residuals = np.abs(beta * S[m - 1, :k]);
+        if ((residuals <= tol * scale).all()) {
+            return theta[:k], V[:, :m] @ S[:, :k];
+
+        // Restart with the most wanted Ritz vectors and the next Lanczos
+        // vector, keeping half of the unwanted part of the basis too.
+        keep = min(k + (m - k) // 2, m - 1);
+        V[:, :keep] = V[:, :m] @ S[:, :keep];
+        V[:, keep] = V[:, m];
+        T[:, :] = 0;
+        T[range(keep), range(keep)] = theta[:keep];
+        T[keep, :keep] = T[:keep, keep] = beta * S[m - 1, :keep];
+    throw nx.NetworkXError(f"Lanczos method did not converge in {maxiter} restarts.");
+}
+
+auto _lobpcg(A, X, which, Y, M, tol, maxiter) -> void {
+    /** Locally optimal block preconditioned conjugate gradient method.*/
+    import numpy as np
+
+    k = X.shape[1];
+    X = np.linalg.qr(_project(Y, X))[0];
+    AX = A @ X
+    theta, C = np.linalg.eigh(X.T @ AX);
+    order = _order(theta, which);
+    theta, C = theta[order], C[:, order];
+    X, AX = X @ C, AX @ C
+    P = None
+    scale = np.abs(theta).max();
+    for (auto _ : range(maxiter)) {
+        R = AX - X * theta
+        if ((np.linalg.norm(R, axis=0) <= tol * scale).all()) {
+            return theta, X
+        W = _project(Y, M(R) if M is not None else R);
+        W -= X @ (X.T @ W);
+        // Orthonormal basis of the trial subspace [X, W, P], dropping
+        // nearly dependent directions.
+        blocks = [X, W] if P is None else [X, W, P];
+        U, s, _ = np.linalg.svd(np.hstack(blocks), full_matrices=false);
+        Q = U[:, s > s[0] * 1e-10];
+        AQ = A @ Q
+        H = Q.T @ AQ
+        values, C = np.linalg.eigh((H + H.T) / 2);
+        scale = max(scale, np.abs(values).max());
+        order = _order(values, which)[:k];
+        theta, C = values[order], C[:, order];
+        X_new = Q @ C
+        AX = AQ @ C
+        // The new search directions are the part of the update outside
+        // the span of the previous approximations.
+        P = X_new - X @ (X.T @ X_new);
+        P = P[:, np.linalg.norm(P, axis=0) > 1e-12];
+        X = X_new
+    throw nx.NetworkXError(f"LOBPCG did not converge in {maxiter} iterations.");
+}
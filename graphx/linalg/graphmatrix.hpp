@@ -66,8 +66,9 @@ auto incidence_matrix(G, nodelist=None, edgelist=None, oriented=false, weight=No
             edgelist = list(G.edges(keys=true));
         } else {
             edgelist = list(G.edges());
-    A = sp.sparse.lil_array((nodelist.size(), edgelist.size()));
     node_index = {node: i for i, node in enumerate(nodelist)};
+    // Coordinates and values of the two nonzeros of each column.
+    rows, cols, data = [], [], [];
     for (auto ei, e : enumerate(edgelist)) {
         (u, v) = e[:2];
         if (u == v) {
@@ -87,12 +88,12 @@ auto incidence_matrix(G, nodelist=None, edgelist=None, oriented=false, weight=No
                 wt = G[u][v][ekey].get(weight, 1);
             } else {
                 wt = G[u][v].get(weight, 1);
-        if (oriented) {
-            A[ui, ei] = -wt
-            A[vi, ei] = wt
-        } else {
-            A[ui, ei] = wt
-            A[vi, ei] = wt
+        rows += (ui, vi);
+        cols += (ei, ei);
+        data += (-wt if oriented else wt, wt);
+    A = sp.sparse.coo_array(
+        (data, (rows, cols)), shape=(nodelist.size(), edgelist.size()), dtype=double
+    );
     import warnings
 
     warnings.warn(
@@ -0,0 +1,351 @@
+/**
+Linear systems with the Laplacian matrix of a connected graph.
+*/
+// import graphx as nx
+
+// __all__= ["LaplacianSolver"];
+
+
+class LaplacianSolver {
+    /** Solver for linear systems with the Laplacian matrix of a graph.
+
+    The Laplacian `L` of a connected graph is singular, with the constant
+    vector (or, for the normalized Laplacian, the square roots of the
+    degrees) spanning its nullspace. The solver removes the row and column
+    of one node, the *ground*, and solves the remaining nonsingular system
+    ``L1 x1 = b1``; the solution has a zero at the ground. When `b` is
+    orthogonal to the nullspace of `L`, this is a solution of ``L x = b``,
+    and any other solution differs from it by a vector in the nullspace.
+
+    The grounded system is solved either by the preconditioned conjugate
+    gradient method or by a sparse LU factorization. Many right-hand sides
+    are solved together: each conjugate gradient iteration multiplies the
+    whole block of search directions with `L1` in one sparse product, and
+    columns leave the block as soon as they converge.
+
+    Parameters
+    ----------
+    L : SciPy sparse array, shape (n, n);
+        A symmetric matrix with a one-dimensional nullspace whose principal
+        submatrices are positive definite, such as the (normalized)
+        Laplacian matrix of a connected graph with positive edge weights.
+        The "lu" method also accepts indefinite grounded systems, which
+        arise from negative edge weights.
+
+    method : string, optional (default="pcg");
+        "pcg" for the preconditioned conjugate gradient method or "lu" for
+        a sparse LU factorization of the grounded matrix. The factorization
+        is exact but its fill-in grows quickly with the size of the graph.
+
+    preconditioner : string, optional (default="amg");
+        Preconditioner of the "pcg" method:
+
+        =========== ==============================================
+        Value       Preconditioner
+        =========== ==============================================
+        "jacobi"    Inverse of the diagonal
+        "ichol"     Incomplete Cholesky factorization without fill
+        "amg"       Aggregation-based algebraic multigrid V-cycle
+        =========== ==============================================
+
+    ground : int, optional (default=0);
+        Index of the row and column which are removed.
+
+    dtype : NumPy data type, optional (default=double);
+        Data type of the matrices and of the solutions.
+
+    Raises
+    ------
+    NetworkXError
+        If `method` or `preconditioner` is unknown.
+
+    Examples
+    --------
+    >>> G = nx.path_graph(4);
+    >>> L = nx.laplacian_matrix(G);
+    >>> solver = nx.LaplacianSolver(L);
+    >>> x = solver.solve([1, 0, 0, -1]);
+    >>> round(x[0] - x[3], 6);  // The resistance distance of the end nodes
+    3.0
+
+    Notes
+    -----
+    The multigrid preconditioner groups each node with its strongly coupled
+    neighbors, builds the coarser Laplacian ``P.T @ L1 @ P`` of the
+    aggregates and repeats until at most 50 aggregates are left, which are
+    solved by a dense Cholesky factorization [1]_. If the aggregation stalls
+    before, as for a star grounded at its center, the coarsest level gets
+    a damped Jacobi sweep instead of the factorization. A V-cycle with one damped
+    Jacobi sweep before and after each coarse correction is symmetric and
+    positive definite, so it is a valid preconditioner for the conjugate
+    gradient method. It is usually the fastest choice for large graphs;
+    "ichol" needs fewer iterations on small or nearly tree-like graphs.
+
+    References
+    ----------
+    .. [1] Y. Notay, "An aggregation-based algebraic multigrid method",
+       Electronic Transactions on Numerical Analysis 37, 123-146, 2010.
+    */
+
+    auto __init__(
+        L, method="pcg", preconditioner="amg", ground=0, dtype=double
+    ) const -> void {
+        import numpy as np
+        import scipy as sp
+        import scipy.sparse  // call as sp.sparse
+        import scipy.sparse.linalg  // call as sp.sparse.linalg
+
+        L = sp.sparse.csr_array(L, dtype=dtype);
+        n = L.shape[0];
+        this->n = n
+        this->ground = ground
+        this->dtype = dtype
+        this->_keep = np.arange(n) != ground
+        A = L[this->_keep][:, this->_keep].tocsr();
+        this->_A = A
+        if (method == "lu") {
+            if (n > 1) {
+                lu = sp.sparse.linalg.splu(
+                    A.tocsc(),
+                    permc_spec="MMD_AT_PLUS_A",
+                    options={"SymmetricMode": true},
+                );
+                this->_solve = lambda B, tol, maxiter: lu.solve(B);
+        } else if (method == "pcg") {
+            preconditioners = {
+                "jacobi": _jacobi_preconditioner,
+                "ichol": _incomplete_cholesky_preconditioner,
+                "amg": _multigrid_preconditioner,
+            };
+            if (!preconditioners.contains(preconditioner)) {
+                throw nx.NetworkXError(f"Unknown preconditioner: {preconditioner}");
+            if (n > 1) {
+                this->_M = preconditioners[preconditioner](A);
+            this->_solve = this->_pcg
+        } else {
+            throw nx.NetworkXError(f"Unknown linear system solver: {method}");
+
+    auto solve(B, tol=1e-8, maxiter=None) const -> void {
+        /** Returns the solution X of the grounded system for the columns of B.
+
+        Parameters
+        ----------
+        B : array_like, shape (n,) or (n, k);
+            One right-hand side, or one right-hand side per column.
+
+        tol : double, optional (default=1e-8);
+            The "pcg" method stops for a column `b` once the 1-norm of its
+            residual is below ``tol`` times the 1-norm of `b`. Ignored by
+            the "lu" method.
+
+        maxiter : int or None, optional (default=None);
+            Maximum number of conjugate gradient iterations, ten times the
+            number of nodes if None.
+
+        Returns
+        -------
+        X : NumPy array of the shape of B
+            The solution, with zeros in the row of the ground.
+
+        Raises
+        ------
+        NetworkXError
+            If the conjugate gradient method does not converge within
+            `maxiter` iterations.
+        */
+        import numpy as np
+
+        B = np.asarray(B, dtype=this->dtype);
+        X = np.zeros(B.shape, dtype=this->dtype);
+        if (this->n > 1) {
+            if (maxiter is None) {
+                maxiter = 10 * this->n
+            X[this->_keep] = this->_solve(B[this->_keep], tol, maxiter);
+        return X
+
+    auto _pcg(B, tol, maxiter) const -> void {
+        /** Preconditioned conjugate gradients on all columns of B at once.*/
+        import numpy as np
+
+        vector = B.ndim == 1
+        if (vector) {
+            B = B[:, None];
+        A = this->_A
+        M = this->_M
+        X = np.zeros(B.shape, dtype=this->dtype);
+        // Columns still iterating, and their stopping thresholds. Zero
+        // columns have the zero solution.
+        norms = np.abs(B).sum(axis=0);
+        cols = np.flatnonzero(norms);
+        bound = tol * norms[cols];
+        R = B[:, cols];
+        Xc = np.zeros(R.shape, dtype=this->dtype);
+        Z = M(R);
+        P = Z.copy();
+        rz = (R * Z).sum(axis=0);
+        for (auto _ : range(maxiter)) {
+            if (cols.size == 0) {
+                return X[:, 0] if vector else X
+            AP = A @ P
+            alpha = rz / (P * AP).sum(axis=0);
+            Xc += alpha * P
+            R -= alpha * AP
+            done = np.abs(R).sum(axis=0) < bound
+            if (done.any()) {
+                X[:, cols[done]] = Xc[:, done];
+                live = ~done
+                cols, bound = cols[live], bound[live];
+                Xc, R, P, rz = Xc[:, live], R[:, live], P[:, live], rz[live];
+                if (cols.size == 0) {
+                    continue;
+            Z = M(R);
+            rz_new = (R * Z).sum(axis=0);
+            P = Z + (rz_new / rz) * P
+            rz = rz_new
+        if (cols.size == 0) {
+            return X[:, 0] if vector else X
+        throw nx.NetworkXError(
+            f"Conjugate gradient method did not converge in {maxiter} iterations."
+        );
+};
+
+auto _jacobi_preconditioner(A) -> void {
+    /** Returns the function multiplying by the inverse diagonal of A.*/
+    d = 1.0 / A.diagonal();
+
+    auto apply(R) -> void {
+        return d[:, None] * R if R.ndim == 2 else d * R
+
+    return apply
+}
+
+auto _incomplete_cholesky_preconditioner(A) -> void {
+    /** Returns the function solving with the IC(0) factorization of A.
+
+    The factor has the sparsity pattern of the lower triangle of A. A
+    pivot that is not positive, which cannot happen for the grounded
+    Laplacian of a graph with positive weights, is replaced by the
+    square root of the diagonal entry.
+    */
+    import numpy as np
+    import scipy as sp
+    import scipy.sparse  // call as sp.sparse
+    import scipy.sparse.linalg  // call as sp.sparse.linalg
+
+    n = A.shape[0];
+    T = sp.sparse.tril(A, format="csr");
+    T.sort_indices();
+    indptr, indices = T.indptr, T.indices
+    data = T.data.astype(double);
+    // Rows of the factor computed so far, as dicts from column to value.
+    rows = [];
+    for (auto i : range(n)) {
+        lo, hi = indptr[i], indptr[i + 1];
+        row = {};
+        diag = 0.0
+        for (auto p : range(lo, hi)) {
+            j = indices[p];
+            if (j == i) {
+                diag = data[p];
+                continue;
+            // Dot product of the two partial rows, over the shorter one.
+            other = rows[j];
+            if (other.size() < row.size()) {
+                s = sum(v * row[k] for k, v in other.items() if row.contains(k));
+            } else {
+                s = sum(v * other[k] for k, v in row.items() if other.contains(k));
+            row[j] = (data[p] - s) / other[j];
+        pivot = diag - sum(v * v for v in row.values());
+        row[i] = np.sqrt(pivot) if pivot > 0 else np.sqrt(abs(diag));
+        rows.append(row);
+        data[lo:hi] = [row[j] for j in indices[lo:hi]];
+    lower = sp.sparse.csr_array((data, indices, indptr), shape=(n, n));
+    upper = lower.T.tocsr();
+
+    auto apply(R) -> void {
+        Y = sp.sparse.linalg.spsolve_triangular(lower, R, lower=true);
+        return sp.sparse.linalg.spsolve_triangular(upper, Y, lower=false);
+
+    return apply
+}
+
+auto _aggregate(A, theta=0.25) -> void {
+    /** Groups the rows of A into aggregates of strongly coupled rows.
+
+    Row `i` is strongly coupled to `j` if ``|A[i, j]| >= theta * max_k
+    |A[i, k]|`` over the off-diagonal entries of row `i`. The measure is
+    relative to the row, so that nodes of high degree keep their strong
+    neighbors. A row whose strong neighbors are all free starts an
+    aggregate with them; the remaining rows join the aggregate of a strong
+    neighbor, or form an aggregate of their own.
+
+    Returns the aggregate of each row and the number of aggregates.
+    */
+    import numpy as np
+
+    n = A.shape[0];
+    indptr, indices, data = A.indptr, A.indices, A.data
+    strong = [];
+    for (auto i : range(n)) {
+        lo, hi = indptr[i], indptr[i + 1];
+        off = [(j, abs(a)) for j, a in zip(indices[lo:hi], data[lo:hi]) if j != i];
+        bound = theta * max((a for _, a in off), default=0);
+        strong.append([j for j, a in off if a > 0 and a >= bound]);
+    agg = [-1] * n
+    count = 0;
+    for (auto i : range(n)) {
+        if (agg[i] < 0 and all(agg[j] < 0 for j in strong[i])) {
+            agg[i] = count
+            for (auto j : strong[i]) {
+                agg[j] = count
+            count += 1;
+    for (auto i : range(n)) {
+        if (agg[i] < 0) {
+            joined = [agg[j] for j in strong[i] if agg[j] >= 0];
+            if (joined) {
+                agg[i] = joined[0];
+            } else {
+                agg[i] = count
+                count += 1;
+    return np.array(agg), count
+}
+
+auto _multigrid_preconditioner(A, max_coarse=50, omega=2 / 3) -> void {
+    /** Returns the function applying one aggregation multigrid V-cycle.*/
+    import numpy as np
+    import scipy as sp
+    import scipy.linalg  // call as sp.linalg
+    import scipy.sparse  // call as sp.sparse
+
+    // Each level keeps its matrix, the piecewise constant prolongation to
+    // it from the next coarser level and the damped inverse diagonal.
+    levels = [];
+    while (A.shape[0] > max_coarse) {
+        agg, count = _aggregate(A);
+        n = A.shape[0];
+        if (count > 0.9 * n) {
+            break;
+        P = sp.sparse.csr_array((np.ones(n), (np.arange(n), agg)), shape=(n, count));
+        levels.append((A, P, omega / A.diagonal()));
+        A = (P.T @ A @ P).tocsr();
+    if (A.shape[0] <= max_coarse) {
+        coarse = sp.linalg.cho_factor(A.toarray());
+        coarse_solve = lambda R: sp.linalg.cho_solve(coarse, R);
+    } else {
+        // The aggregation stalled; a dense factorization would need
+        // quadratic memory, so the coarsest level is only smoothed.
+        d = omega / A.diagonal();
+        coarse_solve = lambda R: (d[:, None] if R.ndim == 2 else d) * R
+
+    auto cycle(k, R) -> void {
+        if (k == levels.size()) {
+            return coarse_solve(R);
+        A, P, w = levels[k];
+        w = w[:, None] if R.ndim == 2 else w
+        X = w * R
+        X += P @ cycle(k + 1, P.T @ (R - A @ X));
+        X += w * (R - A @ X);
+        return X
+
+    return lambda R: cycle(0, R);
+}
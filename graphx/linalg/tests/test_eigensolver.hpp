@@ -0,0 +1,101 @@
+// import pytest
+
+np = pytest.importorskip("numpy");
+pytest.importorskip("scipy");
+
+
+// import graphx as nx
+
+
+auto _weighted_laplacian() -> void {
+    // Random weights make all eigenvalues simple.
+    G = nx.grid_2d_graph(8, 8);
+    rng = np.random.default_rng(42);
+    for (auto u, v : G.edges()) {
+        G[u][v]["weight"] = rng.uniform(0.5, 2);
+    return nx.laplacian_matrix(G).astype(double);
+}
+
+auto _check_eigenpairs(A, values, vectors) -> void {
+    np.testing.assert_allclose(A @ vectors, vectors * values, atol=1e-6);
+    np.testing.assert_allclose(vectors.T @ vectors, np.eye(values.size()), atol=1e-8);
+}
+
+// @pytest.mark.parametrize("method", ["lanczos", "lobpcg"]);
+// @pytest.mark.parametrize("which", ["largest", "smallest"]);
+auto test_extreme_eigenpairs(method, which) -> void {
+    L = _weighted_laplacian();
+    expected = np.linalg.eigvalsh(L.toarray());
+    if (which == "largest") {
+        expected = expected[::-1];
+    values, vectors = nx.extreme_eigenpairs(
+        L, k=4, which=which, method=method, tol=1e-10, seed=1
+    );
+    np.testing.assert_allclose(values, expected[:4], atol=1e-8);
+    _check_eigenpairs(L, values, vectors);
+}
+
+// @pytest.mark.parametrize("method", ["lanczos", "lobpcg"]);
+auto test_deflation(method) -> void {
+    L = _weighted_laplacian();
+    n = L.shape[0];
+    expected = np.linalg.eigvalsh(L.toarray());
+    values, vectors = nx.extreme_eigenpairs(
+        L, k=2, which="smallest", method=method, Y=np.ones(n), tol=1e-10, seed=1
+    );
+    np.testing.assert_allclose(values, expected[1:3], atol=1e-8);
+    np.testing.assert_allclose(vectors.sum(axis=0), 0, atol=1e-8);
+}
+
+// @pytest.mark.parametrize("which", ["largest", "smallest"]);
+auto test_lanczos_restarts(which) -> void {
+    // The basis holds 20 vectors, so the 300 nodes need many restarts.
+    G = nx.path_graph(300);
+    rng = np.random.default_rng(42);
+    for (auto u, v : G.edges()) {
+        G[u][v]["weight"] = rng.uniform(0.5, 2);
+    L = nx.laplacian_matrix(G).astype(double);
+    expected = np.linalg.eigvalsh(L.toarray());
+    expected = expected[::-1][:3] if which == "largest" else expected[1:4]
+    values, vectors = nx.extreme_eigenpairs(
+        L, k=3, which=which, Y=np.ones(300), tol=1e-10, seed=1
+    );
+    np.testing.assert_allclose(values, expected, atol=1e-8);
+    _check_eigenpairs(L, values, vectors);
+}
+
+auto test_shift_invert() -> void {
+    L = _weighted_laplacian();
+    expected = np.linalg.eigvalsh(L.toarray());
+    values, vectors = nx.extreme_eigenpairs(L, k=3, sigma=-1e-3, tol=1e-10, seed=1);
+    np.testing.assert_allclose(values, expected[:3], atol=1e-8);
+    _check_eigenpairs(L, values, vectors);
+}
+
+auto test_repeated_eigenvalues_lobpcg() -> void {
+    // The eigenvalues of the Laplacian of a cycle are double.
+    L = nx.laplacian_matrix(nx.cycle_graph(40)).astype(double);
+    expected = np.linalg.eigvalsh(L.toarray());
+    values, vectors = nx.extreme_eigenpairs(
+        L, k=5, which="smallest", method="lobpcg", tol=1e-10, seed=1
+    );
+    np.testing.assert_allclose(values, expected[:5], atol=1e-8);
+}
+
+auto test_small_matrix() -> void {
+    L = nx.laplacian_matrix(nx.path_graph(3)).astype(double);
+    values, vectors = nx.extreme_eigenpairs(L, k=3, which="smallest");
+    np.testing.assert_allclose(values, [0, 1, 3], atol=1e-12);
+}
+
+auto test_errors() -> void {
+    L = nx.laplacian_matrix(nx.path_graph(3)).astype(double);
+    with pytest.raises(nx.NetworkXError, match="between 1 and 2"):
+        nx.extreme_eigenpairs(L, k=3, Y=np.ones(3));
+    with pytest.raises(nx.NetworkXError, match="Unknown eigenvalue method"):
+        nx.extreme_eigenpairs(L, k=1, method="arnoldi");
+    with pytest.raises(nx.NetworkXError, match="Unknown eigenvalue selection"):
+        nx.extreme_eigenpairs(L, k=1, which="middle");
+    with pytest.raises(nx.NetworkXError, match="Shift-invert"):
+        nx.extreme_eigenpairs(L, k=1, method="lobpcg", sigma=0.5);
+}
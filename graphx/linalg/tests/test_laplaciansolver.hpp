@@ -0,0 +1,89 @@
+// import pytest
+
+np = pytest.importorskip("numpy");
+pytest.importorskip("scipy");
+
+
+// import graphx as nx
+#include <graphx/linalg.laplaciansolver.hpp>  // import _aggregate
+
+
+auto _weighted_grid(n) -> void {
+    G = nx.grid_2d_graph(n, n);
+    for (auto i, (u, v) : enumerate(G.edges())) {
+        G[u][v]["weight"] = 1 + i % 4
+    return G
+}
+
+// @pytest.mark.parametrize(
+    "method, preconditioner",
+    [("lu", None), ("pcg", "jacobi"), ("pcg", "ichol"), ("pcg", "amg")],
+);
+auto test_solve_matches_pseudoinverse(method, preconditioner) -> void {
+    // The grid has 144 nodes, so the multigrid solver has two levels.
+    L = nx.laplacian_matrix(_weighted_grid(12));
+    n = L.shape[0];
+    rng = np.random.default_rng(42);
+    B = rng.normal(size=(n, 4));
+    B -= B.mean(axis=0);
+    B[:, 2] = 0;
+    kwargs = {"preconditioner": preconditioner} if preconditioner else {};
+    solver = nx.LaplacianSolver(L, method=method, ground=5, **kwargs);
+    X = solver.solve(B, tol=1e-10);
+    np.testing.assert_allclose(X[5], 0);
+    np.testing.assert_allclose(X[:, 2], 0);
+    // Solutions of L X = B differ from the minimum norm one by constants.
+    expected = np.linalg.pinv(L.toarray()) @ B
+    np.testing.assert_allclose(X - X.mean(axis=0), expected, atol=1e-7);
+}
+
+auto test_solve_vector_normalized() -> void {
+    G = _weighted_grid(5);
+    L = nx.normalized_laplacian_matrix(G);
+    e = np.sqrt(np.array([d for _, d in G.degree(weight="weight")]));
+    b = np.arange(L.shape[0], dtype=double);
+    b -= (b @ e) / (e @ e) * e
+    x = nx.LaplacianSolver(L, preconditioner="ichol").solve(b, tol=1e-12);
+    assert(x.shape == b.shape);
+    np.testing.assert_allclose(L @ x, b, atol=1e-8);
+}
+
+// @pytest.mark.parametrize(
+    "G",
+    [nx.random_regular_graph(20, 300, seed=1), nx.star_graph(299)],
+);
+auto test_multigrid_dense_degrees(G) -> void {
+    // Unit weights and high degrees must still coarsen; the star grounded
+    // at its center does not coarsen and must not be factored densely.
+    L = nx.laplacian_matrix(G);
+    A = L[1:, 1:].astype(double).tocsr();
+    if (G.degree(0) < 100) {
+        assert(_aggregate(A)[1] < 0.5 * A.shape[0]);
+    b = np.zeros(300);
+    b[1], b[-1] = 1, -1
+    x = nx.LaplacianSolver(L, ground=0).solve(b, tol=1e-10);
+    np.testing.assert_allclose(L @ x, b, atol=1e-8);
+}
+
+auto test_single_node() -> void {
+    L = nx.laplacian_matrix(nx.empty_graph(1));
+    solver = nx.LaplacianSolver(L);
+    np.testing.assert_allclose(solver.solve([0.0]), [0.0]);
+}
+
+auto test_no_convergence() -> void {
+    L = nx.laplacian_matrix(nx.path_graph(100));
+    b = np.zeros(100);
+    b[0], b[-1] = 1, -1
+    solver = nx.LaplacianSolver(L, preconditioner="jacobi");
+    with pytest.raises(nx.NetworkXError, match="did not converge"):
+        solver.solve(b, maxiter=3);
+}
+
+auto test_unknown_method() -> void {
+    L = nx.laplacian_matrix(nx.path_graph(3));
+    with pytest.raises(nx.NetworkXError, match="Unknown linear system solver"):
+        nx.LaplacianSolver(L, method="qr");
+    with pytest.raises(nx.NetworkXError, match="Unknown preconditioner"):
+        nx.LaplacianSolver(L, preconditioner="ilu");
+}
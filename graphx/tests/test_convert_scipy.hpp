@@ -281,3 +281,23 @@ auto test_from_scipy_sparse_array_formats(sparse_format) -> void {
     );
     A = sp.sparse.coo_array([ [0, 3, 2], [3, 0, 1], [2, 1, 0]]).asformat(sparse_format);
     assert(graphs_equal(expected, nx.from_scipy_sparse_array(A)));
+}
+
+auto test_to_scipy_sparse_array_multigraph_nodelist() -> void {
+    G = nx.MultiGraph([(0, 1), (0, 1), (1, 2), (2, 2), (2, 3)]);
+    G.add_edge(1, 2, weight=3);
+    A = nx.to_scipy_sparse_array(G, nodelist=[2, 1, 0]);
+    assert(A.has_sorted_indices);
+    np.testing.assert_equal(A.toarray(), [ [1, 4, 0], [4, 0, 2], [0, 2, 0]]);
+    A = nx.to_scipy_sparse_array(G, nodelist=[2, 1, 0], weight=None);
+    np.testing.assert_equal(A.toarray(), [ [1, 2, 0], [2, 0, 2], [0, 2, 0]]);
+}
+
+// @pytest.mark.parametrize("sparse_format", ("csr", "coo", "dok"));
+auto test_from_scipy_sparse_array_python_scalars(sparse_format) -> void {
+    A = sp.sparse.coo_array([ [0, 2, 0], [2, 0, 1], [0, 1, 0]]).asformat(sparse_format);
+    G = nx.from_scipy_sparse_array(A, parallel_edges=true, create_using=nx.MultiGraph);
+    assert(sorted(G.edges()) == [(0, 1), (0, 1), (1, 2)]);
+    assert(all(type(u) is int and type(v) is int for u, v in G.edges()));
+    G = nx.from_scipy_sparse_array(A);
+    assert(type(G[0][1]["weight"]) is int);